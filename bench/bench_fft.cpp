@@ -0,0 +1,387 @@
+// Micro-benchmark y verificación de precisión de la FFT.
+//
+// Uso: bench_fft [--rapido]
+//
+// Para cada tamaño y variante (recursiva, iterativa con cada conjunto SIMD,
+// real, por lotes y de tamaño fijo) mide el tiempo por transformada y los
+// GFLOPS (5·N·log2(N) flops para la FFT compleja, 2.5·N·log2(N) para la real),
+// y el error máximo frente a una DFT directa O(N²) relativo a la magnitud
+// máxima del espectro. También compara la primera ventana de Prueba1.wav con
+// tests/Fase1/resultados_fft.txt. Devuelve 1 si algún error supera la tolerancia.
+//
+// Las variantes in-place (complejas) incluyen en el tiempo la copia de la
+// entrada, necesaria para no transformar repetidamente el mismo resultado.
+
+#include "audio/LectorAudio.h"
+#include "fft/FFT.h"
+#include "fft/FFTFijo.h"
+#include "procesamiento/Espectrograma.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef DIRECTORIO_PROYECTO
+#define DIRECTORIO_PROYECTO "."
+#endif
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+
+using Espectro = std::vector<std::complex<double>>;
+
+bool rapido = false;
+bool hayErrores = false;
+
+// Tiempo por transformada (ns): mejor de varias muestras, cada una con las
+// repeticiones necesarias para durar al menos unos milisegundos
+template <typename Funcion>
+double medirNs(Funcion transformar, int tramasPorLlamada) {
+    using Reloj = std::chrono::steady_clock;
+    const double duracionMinima = rapido ? 0.5e-3 : 2e-3;
+    const int muestras = rapido ? 3 : 7;
+    
+    int repeticiones = 1;
+    while (true) {
+        auto inicio = Reloj::now();
+        for (int r = 0; r < repeticiones; r++) {
+            transformar();
+        }
+        double segundos = std::chrono::duration<double>(Reloj::now() - inicio).count();
+        if (segundos >= duracionMinima || repeticiones >= (1 << 20)) {
+            break;
+        }
+        repeticiones *= 2;
+    }
+    
+    double mejor = std::numeric_limits<double>::infinity();
+    for (int m = 0; m < muestras; m++) {
+        auto inicio = Reloj::now();
+        for (int r = 0; r < repeticiones; r++) {
+            transformar();
+        }
+        double segundos = std::chrono::duration<double>(Reloj::now() - inicio).count();
+        mejor = std::min(mejor, segundos * 1e9 / ((double)repeticiones * tramasPorLlamada));
+    }
+    return mejor;
+}
+
+// DFT directa O(N²) en doble precisión (k·n se reduce módulo N para conservar
+// la precisión del ángulo)
+Espectro dftDirecta(const Espectro& x) {
+    const int n = x.size();
+    Espectro X(n);
+    for (int k = 0; k < n; k++) {
+        std::complex<double> suma = 0.0;
+        for (int j = 0; j < n; j++) {
+            long long producto = ((long long)k * j) % n;
+            suma += x[j] * std::polar(1.0, -2.0 * PI * producto / n);
+        }
+        X[k] = suma;
+    }
+    return X;
+}
+
+// Error máximo de 'cantidad' espectros consecutivos de 'bins' valores
+// respecto de la referencia, relativo a la magnitud máxima de la referencia
+template <typename T>
+double errorRelativo(const NumeroComplejo<T>* obtenido, int cantidad, int bins, const Espectro& referencia) {
+    double maximo = 0.0;
+    for (int k = 0; k < bins; k++) {
+        maximo = std::max(maximo, std::abs(referencia[k]));
+    }
+    
+    double error = 0.0;
+    for (int f = 0; f < cantidad; f++) {
+        for (int k = 0; k < bins; k++) {
+            const NumeroComplejo<T>& X = obtenido[(size_t)f * bins + k];
+            error = std::max(error, std::abs(referencia[k] - std::complex<double>(X.real, X.imaginario)));
+        }
+    }
+    return maximo > 0.0 ? error / maximo : error;
+}
+
+template <typename T>
+double tolerancia() {
+    return sizeof(T) == sizeof(float) ? 2e-5 : 1e-12;
+}
+
+template <typename T>
+const char* nombreTipo() {
+    return sizeof(T) == sizeof(float) ? "float" : "double";
+}
+
+double gflops(int n, bool real, double ns) {
+    double flops = (real ? 2.5 : 5.0) * n * std::log2((double)n);
+    return flops / ns;
+}
+
+void imprimirFila(const std::string& variante, int n, bool real, double ns, double error, double limite) {
+    bool correcto = error <= limite;
+    if (!correcto) {
+        hayErrores = true;
+    }
+    std::printf("  %-22s %6d %12.1f %9.2f %12.2e  %s\n",
+                variante.c_str(), n, ns, gflops(n, real, ns), error, correcto ? "OK" : "ERROR");
+}
+
+// Variantes de tamaño fijo (sólo para las potencias de 2 que cubre FFTFijo)
+template <typename T, int N>
+bool probarFijo(int n, const std::vector<T>& real, int cantidad, const Espectro& referencia) {
+    if (n != N) {
+        return false;
+    }
+    
+    FFTFijo<T, N> fijo;
+    std::vector<T> lote;
+    for (int f = 0; f < cantidad; f++) {
+        lote.insert(lote.end(), real.begin(), real.end());
+    }
+    std::vector<NumeroComplejo<T>> salida((size_t)cantidad * fijo.numBins());
+    
+    fijo.ejecutarLote(lote.data(), cantidad, salida.data());
+    double error = errorRelativo(salida.data(), cantidad, fijo.numBins(), referencia);
+    double ns = medirNs([&]() { fijo.ejecutarLote(lote.data(), cantidad, salida.data()); }, cantidad);
+    imprimirFila("fija (lotes)", n, true, ns, error, tolerancia<T>());
+    return true;
+}
+
+template <typename T>
+void probarTamano(int n) {
+    std::mt19937 generador(1234 + n);
+    std::uniform_real_distribution<double> distribucion(-0.5, 0.5);
+    
+    // Entrada compleja y real aleatorias, con sus DFT de referencia
+    Espectro entradaRef(n);
+    Espectro realRef(n);
+    std::vector<NumeroComplejo<T>> entrada(n);
+    std::vector<T> real(n);
+    for (int i = 0; i < n; i++) {
+        entrada[i] = NumeroComplejo<T>((T)distribucion(generador), (T)distribucion(generador));
+        entradaRef[i] = std::complex<double>(entrada[i].real, entrada[i].imaginario);
+        real[i] = (T)distribucion(generador);
+        realRef[i] = real[i];
+    }
+    Espectro referencia = dftDirecta(entradaRef);
+    Espectro referenciaReal = dftDirecta(realRef);
+    
+    std::vector<NumeroComplejo<T>> trabajo(n);
+    auto transformarConCopia = [&](auto transformar) {
+        return [&, transformar]() {
+            std::copy(entrada.begin(), entrada.end(), trabajo.begin());
+            transformar();
+        };
+    };
+    
+    // Recursiva (versión de referencia, sólo potencias de 2)
+    if (FFT::esPotenciaDeDos(n)) {
+        auto recursiva = transformarConCopia([&]() { FFT::fftRecursivo(trabajo); });
+        recursiva();
+        double error = errorRelativo(trabajo.data(), 1, n, referencia);
+        imprimirFila("recursiva", n, false, medirNs(recursiva, 1), error, tolerancia<T>());
+    }
+    
+    // Iterativa con cada conjunto de núcleos soportado
+    for (NucleosFFT::Conjunto conjunto : {NucleosFFT::Conjunto::Escalar, NucleosFFT::Conjunto::SSE2,
+                                          NucleosFFT::Conjunto::AVX2, NucleosFFT::Conjunto::AVX512}) {
+        const NucleosFFT::Tabla* nucleos = NucleosFFT::obtener(conjunto);
+        if (!nucleos) {
+            continue;
+        }
+        PlanFFT<T> plan(n, nucleos);
+        auto iterativa = transformarConCopia([&]() { plan.ejecutar(trabajo); });
+        iterativa();
+        double error = errorRelativo(trabajo.data(), 1, n, referencia);
+        imprimirFila(std::string("iterativa [") + nucleos->nombre + "]", n, false,
+                     medirNs(iterativa, 1), error, tolerancia<T>());
+    }
+    
+    // Por lotes (varios bloques y un bloque incompleto)
+    const int cantidad = 2 * PlanFFT<T>::anchoLote + 3;
+    const PlanFFT<T>& plan = FFT::obtenerPlan<T>(n);
+    std::vector<NumeroComplejo<T>> lote;
+    for (int f = 0; f < cantidad; f++) {
+        lote.insert(lote.end(), entrada.begin(), entrada.end());
+    }
+    std::vector<NumeroComplejo<T>> trabajoLote(lote.size());
+    auto porLotes = [&]() {
+        std::copy(lote.begin(), lote.end(), trabajoLote.begin());
+        plan.ejecutarLote(trabajoLote.data(), cantidad);
+    };
+    porLotes();
+    imprimirFila("lotes", n, false, medirNs(porLotes, cantidad),
+                 errorRelativo(trabajoLote.data(), cantidad, n, referencia), tolerancia<T>());
+    
+    // Entrada real: una trama y por lotes
+    const PlanFFTReal<T>& planReal = FFT::obtenerPlanReal<T>(n);
+    std::vector<NumeroComplejo<T>> espectro(planReal.numBins());
+    planReal.ejecutar(real.data(), espectro.data());
+    imprimirFila("real", n, true,
+                 medirNs([&]() { planReal.ejecutar(real.data(), espectro.data()); }, 1),
+                 errorRelativo(espectro.data(), 1, planReal.numBins(), referenciaReal), tolerancia<T>());
+    
+    std::vector<T> loteReal;
+    for (int f = 0; f < cantidad; f++) {
+        loteReal.insert(loteReal.end(), real.begin(), real.end());
+    }
+    std::vector<NumeroComplejo<T>> espectrosLote((size_t)cantidad * planReal.numBins());
+    auto realPorLotes = [&]() { planReal.ejecutarLote(loteReal.data(), cantidad, espectrosLote.data()); };
+    realPorLotes();
+    imprimirFila("real (lotes)", n, true, medirNs(realPorLotes, cantidad),
+                 errorRelativo(espectrosLote.data(), cantidad, planReal.numBins(), referenciaReal),
+                 tolerancia<T>());
+    
+    probarFijo<T, 256>(n, real, cantidad, referenciaReal) ||
+    probarFijo<T, 512>(n, real, cantidad, referenciaReal) ||
+    probarFijo<T, 1024>(n, real, cantidad, referenciaReal) ||
+    probarFijo<T, 2048>(n, real, cantidad, referenciaReal) ||
+    probarFijo<T, 4096>(n, real, cantidad, referenciaReal);
+}
+
+template <typename T>
+void probarRendimiento(const std::vector<int>& tamanos) {
+    std::cout << "\n=== Rendimiento y precisión (" << nombreTipo<T>() << ") ===" << std::endl;
+    std::printf("  %-22s %6s %12s %9s %12s\n", "Variante", "N", "ns/transf", "GFLOPS", "Error rel.");
+    for (int n : tamanos) {
+        probarTamano<T>(n);
+    }
+}
+
+// Primera ventana del espectrograma de Prueba1.wav frente a los valores
+// guardados (frecuencia, magnitud y fase con 6 cifras significativas)
+template <typename T>
+void compararConFase1(const DatosAudio& audio, int inicio, const std::vector<double>& magnitudes,
+                      const std::vector<double>& fases) {
+    const int N = 1024;
+    std::vector<double> hamming = Espectrograma::ventanaHamming(N);
+    std::vector<T> ventana(N);
+    for (int i = 0; i < N; i++) {
+        ventana[i] = (T)(audio.muestras[inicio + i] * hamming[i]);
+    }
+    
+    double maximo = *std::max_element(magnitudes.begin(), magnitudes.end());
+    
+    auto comparar = [&](const std::string& variante, const NumeroComplejo<T>* espectro) {
+        double errorMagnitud = 0.0;
+        double errorFase = 0.0;
+        for (size_t k = 0; k < magnitudes.size(); k++) {
+            errorMagnitud = std::max(errorMagnitud, std::abs(espectro[k].magnitud() - magnitudes[k]) / maximo);
+            
+            // La fase sólo es estable en los bins con energía apreciable
+            if (magnitudes[k] > 0.01 * maximo) {
+                double diferencia = std::remainder(espectro[k].fase() - fases[k], 2.0 * PI);
+                errorFase = std::max(errorFase, std::abs(diferencia));
+            }
+        }
+        
+        double limiteMagnitud = sizeof(T) == sizeof(float) ? 2e-5 : 1e-5;
+        bool correcto = errorMagnitud <= limiteMagnitud && errorFase <= 1e-3;
+        if (!correcto) {
+            hayErrores = true;
+        }
+        std::printf("  %-22s %-8s %12.2e %12.2e  %s\n", variante.c_str(), nombreTipo<T>(),
+                    errorMagnitud, errorFase, correcto ? "OK" : "ERROR");
+    };
+    
+    std::vector<NumeroComplejo<T>> complejo(N);
+    for (int i = 0; i < N; i++) {
+        complejo[i] = NumeroComplejo<T>(ventana[i], T(0));
+    }
+    std::vector<NumeroComplejo<T>> recursiva = complejo;
+    FFT::fftRecursivo(recursiva);
+    comparar("recursiva", recursiva.data());
+    
+    FFT::calcular(complejo);
+    comparar("iterativa", complejo.data());
+    
+    std::vector<NumeroComplejo<T>> real = FFT::calcularReal(ventana);
+    comparar("real", real.data());
+    
+    FFTFijo<T, N> fijo;
+    std::vector<NumeroComplejo<T>> espectroFijo(fijo.numBins());
+    fijo.ejecutarLote(ventana.data(), 1, espectroFijo.data());
+    comparar("fija", espectroFijo.data());
+}
+
+void verificarFase1(const std::string& archivoResultados, const std::string& archivoAudio) {
+    std::cout << "\n=== Comparación con " << archivoResultados << " ===" << std::endl;
+    
+    std::ifstream archivo(archivoResultados);
+    if (!archivo.is_open()) {
+        std::cout << "  [ERROR] No se pudo abrir el archivo de resultados" << std::endl;
+        hayErrores = true;
+        return;
+    }
+    
+    std::vector<double> magnitudes;
+    std::vector<double> fases;
+    std::string linea;
+    std::getline(archivo, linea);  // Encabezado
+    while (std::getline(archivo, linea)) {
+        std::stringstream ss(linea);
+        std::string frecuencia, magnitud, fase;
+        if (std::getline(ss, frecuencia, ',') && std::getline(ss, magnitud, ',') && std::getline(ss, fase)) {
+            magnitudes.push_back(std::stod(magnitud));
+            fases.push_back(std::stod(fase));
+        }
+    }
+    
+    DatosAudio audio = LectorAudio::leerWAV(archivoAudio);
+    
+    // La ventana guardada empieza en la primera muestra audible (como el modo demo)
+    int inicio = 0;
+    for (size_t i = 0; i < audio.muestras.size(); i++) {
+        if (std::abs(audio.muestras[i]) > 0.01f) {
+            inicio = i;
+            break;
+        }
+    }
+    
+    std::printf("  %-22s %-8s %12s %12s\n", "Variante", "Tipo", "Err. magn.", "Err. fase");
+    compararConFase1<double>(audio, inicio, magnitudes, fases);
+    compararConFase1<float>(audio, inicio, magnitudes, fases);
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--rapido") == 0) {
+            rapido = true;
+        } else {
+            std::cout << "Uso: " << argv[0] << " [--rapido]" << std::endl;
+            return 1;
+        }
+    }
+    
+    std::cout << "=== BENCHMARK DE LA FFT ===" << std::endl;
+    std::cout << "Núcleos activos: " << NucleosFFT::activos().nombre << std::endl;
+    
+    // Potencias de 2 habituales, un tamaño de radix mixto (960 = 2^6·3·5) y uno primo (Bluestein)
+    std::vector<int> tamanos = rapido ? std::vector<int>{1024, 960, 1021}
+                                      : std::vector<int>{256, 512, 1024, 2048, 4096, 960, 1021};
+    probarRendimiento<double>(tamanos);
+    probarRendimiento<float>(tamanos);
+    
+    const std::string directorio = DIRECTORIO_PROYECTO;
+    verificarFase1(directorio + "/tests/Fase1/resultados_fft.txt",
+                   directorio + "/datos/muestras/Prueba1.wav");
+    
+    if (hayErrores) {
+        std::cout << "\n[ERROR] Algún resultado supera la tolerancia" << std::endl;
+        return 1;
+    }
+    std::cout << "\n✓ Todas las variantes dentro de la tolerancia" << std::endl;
+    return 0;
+}
@@ -0,0 +1,617 @@
+#include "ArchivoFLAC.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+// Asignaciones de canales de la cabecera de trama (0-7: canales independientes)
+constexpr int izquierdaLateral = 8;
+constexpr int lateralDerecha = 9;
+constexpr int medioLateral = 10;
+
+// Tramos más pequeños no compensan el arranque de un hilo
+constexpr size_t tamanoMinimoTramo = 64 * 1024;
+
+// CRC-8 de la cabecera de trama (polinomio x^8 + x^2 + x + 1)
+uint8_t crc8(const unsigned char* datos, size_t longitud) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < longitud; i++) {
+        crc ^= datos[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// CRC-16 de la trama completa (polinomio x^16 + x^15 + x^2 + 1), por tabla
+uint16_t crc16(const unsigned char* datos, size_t longitud) {
+    static const std::array<uint16_t, 256> tabla = [] {
+        std::array<uint16_t, 256> t{};
+        for (int i = 0; i < 256; i++) {
+            uint16_t crc = (uint16_t)(i << 8);
+            for (int b = 0; b < 8; b++) {
+                crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x8005) : (uint16_t)(crc << 1);
+            }
+            t[i] = crc;
+        }
+        return t;
+    }();
+
+    uint16_t crc = 0;
+    for (size_t i = 0; i < longitud; i++) {
+        crc = (uint16_t)((crc << 8) ^ tabla[(crc >> 8) ^ datos[i]]);
+    }
+    return crc;
+}
+
+int cerosIniciales(uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long indice;
+    _BitScanReverse64(&indice, x);
+    return 63 - (int)indice;
+#else
+    return __builtin_clzll(x);
+#endif
+}
+
+// Lector de bits MSB primero con una caché de 64 bits. Más allá del final de
+// los datos devuelve ceros; quien lo usa comprueba bitsLeidos() al terminar.
+class LectorBits {
+public:
+    LectorBits(const unsigned char* datos, size_t tamano) : datos_(datos), tamano_(tamano) {}
+
+    uint32_t leer(int bits) {
+        if (bits == 0) {
+            return 0;
+        }
+        if (bitsCache_ < bits) {
+            rellenar();
+        }
+        uint32_t valor = (uint32_t)(cache_ >> (64 - bits));
+        cache_ <<= bits;
+        bitsCache_ -= bits;
+        return valor;
+    }
+
+    int32_t leerConSigno(int bits) {
+        if (bits == 0) {
+            return 0;
+        }
+        uint32_t valor = leer(bits);
+        // Extender el signo desde el bit (bits - 1)
+        uint32_t signo = 1u << (bits - 1);
+        return (int32_t)((valor ^ signo) - signo);
+    }
+
+    // Número de ceros antes del siguiente 1 (que también se consume)
+    uint32_t leerUnario() {
+        uint32_t ceros = 0;
+        for (;;) {
+            if (bitsCache_ <= 56) {
+                rellenar();
+            }
+            if (cache_ != 0) {
+                int z = cerosIniciales(cache_);
+                ceros += (uint32_t)z;
+                cache_ = z < 63 ? cache_ << (z + 1) : 0;
+                bitsCache_ -= z + 1;
+                return ceros;
+            }
+            ceros += (uint32_t)bitsCache_;
+            bitsCache_ = 0;
+            if (posicion_ > tamano_ + 8) {
+                throw std::runtime_error("Código unario FLAC fuera de la trama");
+            }
+        }
+    }
+
+    void alinearByte() {
+        leer(bitsCache_ % 8);
+    }
+
+    size_t bitsLeidos() const { return posicion_ * 8 - (size_t)bitsCache_; }
+
+private:
+    void rellenar() {
+        while (bitsCache_ <= 56) {
+            uint64_t byte = posicion_ < tamano_ ? datos_[posicion_] : 0;
+            cache_ |= byte << (56 - bitsCache_);
+            posicion_++;
+            bitsCache_ += 8;
+        }
+    }
+
+    const unsigned char* datos_;
+    size_t tamano_;
+    size_t posicion_ = 0;
+    uint64_t cache_ = 0;
+    int bitsCache_ = 0;
+};
+
+// Campos de la cabecera de una trama
+struct CabeceraTrama {
+    int tamanoBloque;
+    int asignacionCanales;
+    int canales;
+    int bitsPorMuestra;
+    uint64_t primeraMuestra;
+    size_t longitud;            // Bytes de la cabecera, incluido el CRC-8
+};
+
+// Analizar la cabecera de trama en 'p' y comprobar que es coherente con el
+// STREAMINFO. Devuelve false si no es una cabecera válida.
+bool leerCabecera(const unsigned char* p, size_t disponibles, const InfoFLAC& info, CabeceraTrama& cabecera) {
+    // Sincronía de 14 bits, bit reservado a cero y estrategia de bloque
+    if (disponibles < 6 || p[0] != 0xFF || (p[1] & 0xFE) != 0xF8) {
+        return false;
+    }
+    bool bloqueVariable = (p[1] & 0x01) != 0;
+
+    int codigoBloque = p[2] >> 4;
+    int codigoFrecuencia = p[2] & 0x0F;
+    cabecera.asignacionCanales = p[3] >> 4;
+    int codigoBits = (p[3] >> 1) & 0x07;
+    if (codigoBloque == 0 || codigoFrecuencia == 15 || cabecera.asignacionCanales > medioLateral ||
+        codigoBits == 3 || (p[3] & 0x01) != 0) {
+        return false;
+    }
+
+    // Número de trama (bloque fijo) o de muestra (bloque variable) en UTF-8
+    size_t i = 4;
+    uint64_t numero;
+    int continuacion;
+    unsigned char primero = p[i++];
+    if (primero < 0x80)                { numero = primero;        continuacion = 0; }
+    else if ((primero & 0xE0) == 0xC0) { numero = primero & 0x1F; continuacion = 1; }
+    else if ((primero & 0xF0) == 0xE0) { numero = primero & 0x0F; continuacion = 2; }
+    else if ((primero & 0xF8) == 0xF0) { numero = primero & 0x07; continuacion = 3; }
+    else if ((primero & 0xFC) == 0xF8) { numero = primero & 0x03; continuacion = 4; }
+    else if ((primero & 0xFE) == 0xFC) { numero = primero & 0x01; continuacion = 5; }
+    else if (primero == 0xFE && bloqueVariable) { numero = 0;     continuacion = 6; }
+    else return false;
+
+    if (disponibles < i + continuacion + 5) {
+        return false;
+    }
+    for (int c = 0; c < continuacion; c++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            return false;
+        }
+        numero = (numero << 6) | (p[i++] & 0x3F);
+    }
+
+    // Tamaño de bloque
+    if (codigoBloque == 1) {
+        cabecera.tamanoBloque = 192;
+    } else if (codigoBloque <= 5) {
+        cabecera.tamanoBloque = 576 << (codigoBloque - 2);
+    } else if (codigoBloque == 6) {
+        cabecera.tamanoBloque = p[i++] + 1;
+    } else if (codigoBloque == 7) {
+        cabecera.tamanoBloque = ((p[i] << 8) | p[i + 1]) + 1;
+        i += 2;
+    } else {
+        cabecera.tamanoBloque = 256 << (codigoBloque - 8);
+    }
+
+    // Frecuencia de muestreo (sólo se usa para validar la cabecera)
+    static const int frecuencias[12] = {0, 88200, 176400, 192000, 8000, 16000,
+                                        22050, 24000, 32000, 44100, 48000, 96000};
+    int frecuencia = info.frecuenciaMuestreo;
+    if (codigoFrecuencia == 0) {
+        // La del STREAMINFO
+    } else if (codigoFrecuencia < 12) {
+        frecuencia = frecuencias[codigoFrecuencia];
+    } else if (codigoFrecuencia == 12) {
+        frecuencia = p[i++] * 1000;
+    } else {
+        frecuencia = (p[i] << 8) | p[i + 1];
+        if (codigoFrecuencia == 14) {
+            frecuencia *= 10;
+        }
+        i += 2;
+    }
+
+    static const int bits[8] = {0, 8, 12, 0, 16, 20, 24, 32};
+    cabecera.bitsPorMuestra = codigoBits == 0 ? info.bitsPorMuestra : bits[codigoBits];
+    cabecera.canales = cabecera.asignacionCanales < izquierdaLateral ? cabecera.asignacionCanales + 1 : 2;
+
+    if (crc8(p, i) != p[i]) {
+        return false;
+    }
+    cabecera.longitud = i + 1;
+
+    if (frecuencia != info.frecuenciaMuestreo || cabecera.canales != info.numeroCanales ||
+        cabecera.bitsPorMuestra != info.bitsPorMuestra ||
+        (info.tamanoBloqueMaximo > 0 && cabecera.tamanoBloque > info.tamanoBloqueMaximo)) {
+        return false;
+    }
+
+    cabecera.primeraMuestra = bloqueVariable ? numero : numero * (uint64_t)info.tamanoBloqueMaximo;
+    return true;
+}
+
+// Residuo con codificación Rice particionada, a partir de la muestra 'orden'
+void decodificarResiduo(LectorBits& lector, int orden, int tamanoBloque, int32_t* destino) {
+    uint32_t metodo = lector.leer(2);
+    if (metodo > 1) {
+        throw std::runtime_error("Método de codificación del residuo FLAC reservado");
+    }
+    const int bitsParametro = metodo == 0 ? 4 : 5;
+    const uint32_t escape = metodo == 0 ? 15 : 31;
+
+    int ordenParticion = (int)lector.leer(4);
+    int muestrasParticion = tamanoBloque >> ordenParticion;
+    if ((muestrasParticion << ordenParticion) != tamanoBloque || muestrasParticion < orden) {
+        throw std::runtime_error("Particiones del residuo FLAC incoherentes con el bloque");
+    }
+
+    int i = orden;
+    for (int particion = 0; particion < (1 << ordenParticion); particion++) {
+        int fin = (particion + 1) * muestrasParticion;
+        uint32_t parametro = lector.leer(bitsParametro);
+
+        if (parametro == escape) {
+            // Partición sin codificar: muestras con signo de ancho fijo
+            int bitsCrudos = (int)lector.leer(5);
+            for (; i < fin; i++) {
+                destino[i] = lector.leerConSigno(bitsCrudos);
+            }
+        } else {
+            for (; i < fin; i++) {
+                uint32_t cociente = lector.leerUnario();
+                uint32_t valor = (cociente << parametro) | lector.leer((int)parametro);
+                // Deshacer el plegado de signo (0, -1, 1, -2, ...)
+                destino[i] = (int32_t)(valor >> 1) ^ -(int32_t)(valor & 1);
+            }
+        }
+    }
+}
+
+// Subtrama de un canal con 'bits' bits por muestra
+void decodificarSubtrama(LectorBits& lector, int bits, int tamanoBloque, int32_t* destino) {
+    if (lector.leer(1) != 0) {
+        throw std::runtime_error("Relleno de subtrama FLAC distinto de cero");
+    }
+    uint32_t tipo = lector.leer(6);
+
+    // Bits desperdiciados: las muestras se codificaron desplazadas a la derecha
+    int desperdiciados = 0;
+    if (lector.leer(1) != 0) {
+        desperdiciados = (int)lector.leerUnario() + 1;
+        if (desperdiciados >= bits) {
+            throw std::runtime_error("Bits desperdiciados de la subtrama FLAC inválidos");
+        }
+        bits -= desperdiciados;
+    }
+
+    if (tipo == 0) {
+        // Constante
+        std::fill(destino, destino + tamanoBloque, lector.leerConSigno(bits));
+    } else if (tipo == 1) {
+        // Literal
+        for (int i = 0; i < tamanoBloque; i++) {
+            destino[i] = lector.leerConSigno(bits);
+        }
+    } else if (tipo >= 8 && tipo <= 12) {
+        // Predicción fija de orden 0 a 4
+        int orden = (int)tipo - 8;
+        if (orden > tamanoBloque) {
+            throw std::runtime_error("Orden de predicción FLAC mayor que el bloque");
+        }
+        for (int i = 0; i < orden; i++) {
+            destino[i] = lector.leerConSigno(bits);
+        }
+        decodificarResiduo(lector, orden, tamanoBloque, destino);
+
+        int32_t* x = destino;
+        switch (orden) {
+        case 1:
+            for (int i = 1; i < tamanoBloque; i++) x[i] += x[i - 1];
+            break;
+        case 2:
+            for (int i = 2; i < tamanoBloque; i++) x[i] += 2 * x[i - 1] - x[i - 2];
+            break;
+        case 3:
+            for (int i = 3; i < tamanoBloque; i++) x[i] += 3 * (x[i - 1] - x[i - 2]) + x[i - 3];
+            break;
+        case 4:
+            for (int i = 4; i < tamanoBloque; i++) x[i] += 4 * (x[i - 1] + x[i - 3]) - 6 * x[i - 2] - x[i - 4];
+            break;
+        default:
+            break;
+        }
+    } else if (tipo >= 32) {
+        // Predicción lineal (LPC) de orden 1 a 32
+        int orden = (int)tipo - 31;
+        if (orden > tamanoBloque) {
+            throw std::runtime_error("Orden de predicción FLAC mayor que el bloque");
+        }
+        for (int i = 0; i < orden; i++) {
+            destino[i] = lector.leerConSigno(bits);
+        }
+
+        int precision = (int)lector.leer(4) + 1;
+        int desplazamiento = lector.leerConSigno(5);
+        if (precision == 16 || desplazamiento < 0) {
+            throw std::runtime_error("Coeficientes LPC de la subtrama FLAC inválidos");
+        }
+        int32_t coeficientes[32];
+        for (int j = 0; j < orden; j++) {
+            coeficientes[j] = lector.leerConSigno(precision);
+        }
+
+        decodificarResiduo(lector, orden, tamanoBloque, destino);
+
+        // x[i] = residuo[i] + (sum_j c[j] · x[i - 1 - j]) >> desplazamiento
+        for (int i = orden; i < tamanoBloque; i++) {
+            int64_t suma = 0;
+            const int32_t* anterior = destino + i - 1;
+            for (int j = 0; j < orden; j++) {
+                suma += (int64_t)coeficientes[j] * anterior[-j];
+            }
+            destino[i] += (int32_t)(suma >> desplazamiento);
+        }
+    } else {
+        throw std::runtime_error("Tipo de subtrama FLAC reservado");
+    }
+
+    if (desperdiciados > 0) {
+        for (int i = 0; i < tamanoBloque; i++) {
+            destino[i] = (int32_t)((uint32_t)destino[i] << desperdiciados);
+        }
+    }
+}
+
+}
+
+ArchivoFLAC::ArchivoFLAC(const std::string& nombreArchivo)
+    : archivo_(nombreArchivo) {
+    const unsigned char* base = archivo_.datos();
+    size_t tamanoArchivo = archivo_.tamano();
+
+    // Etiqueta ID3v2 opcional delante del flujo (tamaño en 4 bytes de 7 bits)
+    size_t posicion = 0;
+    if (tamanoArchivo >= 10 && std::memcmp(base, "ID3", 3) == 0) {
+        posicion = 10 + (((size_t)(base[6] & 0x7F) << 21) | ((size_t)(base[7] & 0x7F) << 14) |
+                         ((size_t)(base[8] & 0x7F) << 7) | (size_t)(base[9] & 0x7F));
+    }
+
+    if (posicion + 4 > tamanoArchivo || std::memcmp(base + posicion, "fLaC", 4) != 0) {
+        throw std::runtime_error("No es un archivo FLAC válido: " + nombreArchivo);
+    }
+    posicion += 4;
+
+    // Bloques de metadatos: cabecera de 4 bytes (último, tipo, longitud de 24 bits)
+    bool infoEncontrada = false;
+    bool ultimo = false;
+    while (!ultimo) {
+        if (posicion + 4 > tamanoArchivo) {
+            throw std::runtime_error("Metadatos FLAC truncados: " + nombreArchivo);
+        }
+        ultimo = (base[posicion] & 0x80) != 0;
+        int tipo = base[posicion] & 0x7F;
+        size_t longitud = ((size_t)base[posicion + 1] << 16) | ((size_t)base[posicion + 2] << 8) | base[posicion + 3];
+        posicion += 4;
+        if (posicion + longitud > tamanoArchivo) {
+            throw std::runtime_error("Metadatos FLAC truncados: " + nombreArchivo);
+        }
+
+        if (tipo == 0) {
+            if (longitud < 34) {
+                throw std::runtime_error("Bloque STREAMINFO demasiado corto");
+            }
+            const unsigned char* s = base + posicion;
+            info_.tamanoBloqueMinimo = (s[0] << 8) | s[1];
+            info_.tamanoBloqueMaximo = (s[2] << 8) | s[3];
+            info_.tamanoTramaMinimo = (s[4] << 16) | (s[5] << 8) | s[6];
+            info_.tamanoTramaMaximo = (s[7] << 16) | (s[8] << 8) | s[9];
+            info_.frecuenciaMuestreo = (s[10] << 12) | (s[11] << 4) | (s[12] >> 4);
+            info_.numeroCanales = ((s[12] >> 1) & 0x07) + 1;
+            info_.bitsPorMuestra = (((s[12] & 0x01) << 4) | (s[13] >> 4)) + 1;
+            info_.totalMuestras = ((uint64_t)(s[13] & 0x0F) << 32) | ((uint64_t)s[14] << 24) |
+                                  ((uint64_t)s[15] << 16) | ((uint64_t)s[16] << 8) | s[17];
+            std::memcpy(info_.md5, s + 18, 16);
+            infoEncontrada = true;
+        }
+        posicion += longitud;
+    }
+
+    if (!infoEncontrada) {
+        throw std::runtime_error("Archivo FLAC sin bloque STREAMINFO: " + nombreArchivo);
+    }
+    if (info_.frecuenciaMuestreo <= 0) {
+        throw std::runtime_error("Frecuencia de muestreo FLAC inválida");
+    }
+    if (info_.bitsPorMuestra < 4 || info_.bitsPorMuestra > 24) {
+        throw std::runtime_error("FLAC de " + std::to_string(info_.bitsPorMuestra) +
+                                 " bits por muestra no soportado (4 a 24)");
+    }
+
+    inicioTramas_ = posicion;
+}
+
+ArchivoFLAC::Trama ArchivoFLAC::decodificarTrama(size_t posicion, std::vector<float>& salida) const {
+    const unsigned char* p = archivo_.datos() + posicion;
+    size_t disponibles = tamano() - posicion;
+
+    CabeceraTrama cabecera;
+    if (posicion >= tamano() || !leerCabecera(p, disponibles, info_, cabecera)) {
+        throw std::runtime_error("Cabecera de trama FLAC inválida en la posición " + std::to_string(posicion));
+    }
+    const int n = cabecera.tamanoBloque;
+    const int canales = cabecera.canales;
+
+    // Muestras enteras de cada canal (reutilizadas entre tramas en cada hilo)
+    thread_local std::vector<int32_t> enteras;
+    enteras.resize((size_t)canales * n);
+
+    LectorBits lector(p + cabecera.longitud, disponibles - cabecera.longitud);
+    for (int c = 0; c < canales; c++) {
+        // El canal lateral lleva un bit más
+        bool lateral = (cabecera.asignacionCanales == izquierdaLateral && c == 1) ||
+                       (cabecera.asignacionCanales == lateralDerecha && c == 0) ||
+                       (cabecera.asignacionCanales == medioLateral && c == 1);
+        decodificarSubtrama(lector, cabecera.bitsPorMuestra + (lateral ? 1 : 0), n, enteras.data() + (size_t)c * n);
+    }
+    lector.alinearByte();
+
+    size_t longitud = cabecera.longitud + lector.bitsLeidos() / 8;
+    if (longitud + 2 > disponibles) {
+        throw std::runtime_error("Trama FLAC truncada en la posición " + std::to_string(posicion));
+    }
+    uint16_t crc = (uint16_t)((p[longitud] << 8) | p[longitud + 1]);
+    if (crc16(p, longitud) != crc) {
+        throw std::runtime_error("CRC incorrecto en la trama FLAC de la posición " + std::to_string(posicion));
+    }
+
+    // Deshacer la decorrelación estéreo
+    int32_t* a = enteras.data();
+    int32_t* b = enteras.data() + n;
+    if (cabecera.asignacionCanales == izquierdaLateral) {
+        for (int i = 0; i < n; i++) b[i] = a[i] - b[i];
+    } else if (cabecera.asignacionCanales == lateralDerecha) {
+        for (int i = 0; i < n; i++) a[i] += b[i];
+    } else if (cabecera.asignacionCanales == medioLateral) {
+        for (int i = 0; i < n; i++) {
+            int32_t medio = (int32_t)(((uint32_t)a[i] << 1) | (uint32_t)(b[i] & 1));
+            int32_t lateral = b[i];
+            a[i] = (medio + lateral) >> 1;
+            b[i] = (medio - lateral) >> 1;
+        }
+    }
+
+    // Normalizar y mezclar a mono en el mismo orden que NucleosAudio
+    const float escala = 1.0f / (float)(1u << (cabecera.bitsPorMuestra - 1));
+    size_t inicioSalida = salida.size();
+    salida.resize(inicioSalida + n);
+    float* mono = salida.data() + inicioSalida;
+    if (canales == 1) {
+        for (int i = 0; i < n; i++) mono[i] = (float)a[i] * escala;
+    } else if (canales == 2) {
+        for (int i = 0; i < n; i++) mono[i] = ((float)a[i] * escala + (float)b[i] * escala) * 0.5f;
+    } else {
+        for (int i = 0; i < n; i++) {
+            float suma = (float)a[i] * escala;
+            for (int c = 1; c < canales; c++) {
+                suma += (float)enteras[(size_t)c * n + i] * escala;
+            }
+            mono[i] = suma / (float)canales;
+        }
+    }
+
+    Trama trama;
+    trama.posicion = posicion;
+    trama.tamano = longitud + 2;
+    trama.primeraMuestra = cabecera.primeraMuestra;
+    trama.numMuestras = n;
+    return trama;
+}
+
+size_t ArchivoFLAC::buscarTrama(size_t desde) const {
+    const unsigned char* base = archivo_.datos();
+    const size_t total = tamano();
+    CabeceraTrama cabecera;
+
+    for (size_t i = std::max(desde, inicioTramas_); i + 1 < total; i++) {
+        const void* encontrado = std::memchr(base + i, 0xFF, total - i - 1);
+        if (encontrado == nullptr) {
+            break;
+        }
+        i = (size_t)((const unsigned char*)encontrado - base);
+        if (leerCabecera(base + i, total - i, info_, cabecera)) {
+            return i;
+        }
+    }
+    return total;
+}
+
+size_t ArchivoFLAC::decodificarSecuencial(size_t inicio, size_t fin, std::vector<float>& salida) const {
+    size_t posicion = inicio;
+    while (posicion < fin && posicion < tamano()) {
+        CabeceraTrama cabecera;
+        if (!leerCabecera(archivo_.datos() + posicion, tamano() - posicion, info_, cabecera)) {
+            // Tras la última trama sólo puede haber datos ajenos (p. ej. una
+            // etiqueta ID3v1); si hay más tramas, el archivo está dañado
+            if (buscarTrama(posicion) == tamano()) {
+                return tamano();
+            }
+            throw std::runtime_error("Trama FLAC inválida en la posición " + std::to_string(posicion));
+        }
+        posicion += decodificarTrama(posicion, salida).tamano;
+    }
+    return posicion;
+}
+
+size_t ArchivoFLAC::decodificar(size_t inicio, size_t fin, int hilos, std::vector<float>& salida) const {
+    fin = std::min(fin, tamano());
+    if (inicio >= fin) {
+        return inicio;
+    }
+
+    if (hilos <= 0) {
+        hilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+    hilos = (int)std::min<size_t>((size_t)hilos, std::max<size_t>(1, (fin - inicio) / tamanoMinimoTramo));
+    if (hilos == 1) {
+        return decodificarSecuencial(inicio, fin, salida);
+    }
+
+    // Cada tramo empieza en la primera cabecera válida tras su parte del rango
+    std::vector<size_t> limites(hilos + 1);
+    limites[0] = inicio;
+    for (int k = 1; k < hilos; k++) {
+        size_t aproximado = inicio + (fin - inicio) * k / hilos;
+        limites[k] = std::max(limites[k - 1], std::min(fin, buscarTrama(aproximado)));
+    }
+    limites[hilos] = fin;
+
+    std::vector<std::vector<float>> partes(hilos);
+    std::vector<size_t> finales(hilos, 0);
+    std::vector<std::exception_ptr> errores(hilos);
+    std::vector<std::thread> trabajadores;
+    for (int k = 0; k < hilos; k++) {
+        trabajadores.emplace_back([&, k] {
+            try {
+                finales[k] = decodificarSecuencial(limites[k], limites[k + 1], partes[k]);
+            } catch (...) {
+                errores[k] = std::current_exception();
+            }
+        });
+    }
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+
+    // Encadenar los tramos: uno sólo vale si empieza justo donde terminó el
+    // anterior; si no (cabecera falsa o error), se decodifica de nuevo en
+    // secuencia desde la posición real, que propaga los errores verdaderos
+    size_t posicion = inicio;
+    for (int k = 0; k < hilos; k++) {
+        if (limites[k] == posicion && !errores[k]) {
+            salida.insert(salida.end(), partes[k].begin(), partes[k].end());
+            posicion = finales[k];
+        } else if (posicion < limites[k + 1]) {
+            posicion = decodificarSecuencial(posicion, limites[k + 1], salida);
+        }
+        std::vector<float>().swap(partes[k]);
+    }
+    return posicion;
+}
+
+void ArchivoFLAC::avisarLecturaSecuencial() const {
+    archivo_.avisarLecturaSecuencial(inicioTramas_, tamano() - inicioTramas_);
+}
+
+void ArchivoFLAC::descartarDatos(size_t inicio, size_t longitud) const {
+    archivo_.descartarRango(inicio, longitud);
+}
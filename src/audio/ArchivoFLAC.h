@@ -0,0 +1,87 @@
+#ifndef ARCHIVO_FLAC_H
+#define ARCHIVO_FLAC_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ArchivoMapeado.h"
+
+// Campos del bloque de metadatos STREAMINFO de un archivo FLAC
+struct InfoFLAC {
+    int tamanoBloqueMinimo = 0;     // Muestras por canal de cada trama
+    int tamanoBloqueMaximo = 0;
+    int tamanoTramaMinimo = 0;      // Bytes (0 = desconocido)
+    int tamanoTramaMaximo = 0;
+    int frecuenciaMuestreo = 0;
+    int numeroCanales = 0;
+    int bitsPorMuestra = 0;
+    uint64_t totalMuestras = 0;     // Muestras por canal (0 = desconocido)
+    unsigned char md5[16] = {};     // Firma del audio sin comprimir (no se verifica)
+};
+
+// Decodificador FLAC propio, sin dependencias externas, sobre el archivo
+// proyectado en memoria. Soporta subtramas constantes, literales, de
+// predicción fija y LPC, residuos Rice (con particiones de escape), bits
+// desperdiciados, decorrelación estéreo izquierda/lateral, lateral/derecha y
+// medio/lateral, y tramas de tamaño de bloque fijo o variable de hasta 24
+// bits. Cada trama se comprueba con su CRC-16; la firma MD5 del STREAMINFO no
+// se calcula.
+//
+// Las tramas se decodifican directamente a muestras mono normalizadas a
+// [-1.0, 1.0], con la misma normalización y mezcla de canales que
+// NucleosAudio: un FLAC y el WAV del que procede dan exactamente las mismas
+// muestras. Como las tramas son independientes, un rango del archivo se puede
+// repartir entre varios hilos (ver decodificar()).
+class ArchivoFLAC {
+public:
+    // Trama decodificada
+    struct Trama {
+        size_t posicion;            // Desplazamiento de su primer byte en el archivo
+        size_t tamano;              // Bytes de la trama (cabecera, subtramas y CRC)
+        uint64_t primeraMuestra;    // Índice (por canal) de su primera muestra
+        int numMuestras;            // Muestras por canal
+    };
+
+    // Proyectar el archivo y leer sus metadatos. Lanza std::runtime_error si
+    // no es un FLAC válido o su formato no está soportado.
+    explicit ArchivoFLAC(const std::string& nombreArchivo);
+
+    const InfoFLAC& info() const { return info_; }
+
+    // Posición de la primera trama de audio (tras los metadatos)
+    size_t inicioTramas() const { return inicioTramas_; }
+    size_t tamano() const { return archivo_.tamano(); }
+
+    // Decodificar la trama que empieza en 'posicion' y añadir a 'salida' sus
+    // muestras mezcladas a mono. Lanza std::runtime_error si la trama está
+    // dañada (cabecera inválida, datos truncados o CRC incorrecto).
+    Trama decodificarTrama(size_t posicion, std::vector<float>& salida) const;
+
+    // Primera posición >= 'desde' con una cabecera de trama válida (código de
+    // sincronía, CRC-8 y campos coherentes con STREAMINFO), o tamano()
+    size_t buscarTrama(size_t desde) const;
+
+    // Decodificar en orden todas las tramas que empiezan en [inicio, fin) y
+    // añadir sus muestras a 'salida'. 'inicio' debe ser el comienzo de una
+    // trama. Con hilos > 1 el rango se divide en tramos que empiezan en la
+    // siguiente cabecera válida y se decodifican en paralelo; las uniones se
+    // verifican y se repiten en secuencia si una cabecera resultó ser un falso
+    // positivo (hilos = 0: uno por núcleo). Devuelve la posición de la trama
+    // siguiente (tamano() al terminar el audio).
+    size_t decodificar(size_t inicio, size_t fin, int hilos, std::vector<float>& salida) const;
+
+    // Indicar al sistema que las tramas se leerán de principio a fin
+    void avisarLecturaSecuencial() const;
+
+    // Devolver al sistema las páginas ya decodificadas (desplazamientos del archivo)
+    void descartarDatos(size_t inicio, size_t longitud) const;
+
+private:
+    size_t decodificarSecuencial(size_t inicio, size_t fin, std::vector<float>& salida) const;
+
+    ArchivoMapeado archivo_;
+    InfoFLAC info_;
+    size_t inicioTramas_ = 0;
+};
+
+#endif
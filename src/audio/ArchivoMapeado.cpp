@@ -0,0 +1,162 @@
+#include "ArchivoMapeado.h"
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+ArchivoMapeado::ArchivoMapeado(const std::string& nombreArchivo) {
+    HANDLE archivo = CreateFileA(nombreArchivo.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (archivo == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("No se pudo abrir el archivo: " + nombreArchivo);
+    }
+    manejadorArchivo_ = archivo;
+
+    LARGE_INTEGER tamano;
+    if (!GetFileSizeEx(archivo, &tamano)) {
+        liberar();
+        throw std::runtime_error("No se pudo obtener el tamaño de: " + nombreArchivo);
+    }
+    tamano_ = (size_t)tamano.QuadPart;
+
+    // Un archivo vacío no se puede proyectar; se representa como vista vacía
+    if (tamano_ == 0) {
+        return;
+    }
+
+    HANDLE proyeccion = CreateFileMappingA(archivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (proyeccion == nullptr) {
+        liberar();
+        throw std::runtime_error("No se pudo proyectar en memoria: " + nombreArchivo);
+    }
+    manejadorProyeccion_ = proyeccion;
+
+    datos_ = (const unsigned char*)MapViewOfFile(proyeccion, FILE_MAP_READ, 0, 0, 0);
+    if (datos_ == nullptr) {
+        liberar();
+        throw std::runtime_error("No se pudo proyectar en memoria: " + nombreArchivo);
+    }
+}
+
+void ArchivoMapeado::liberar() {
+    if (datos_ != nullptr) {
+        UnmapViewOfFile(datos_);
+    }
+    if (manejadorProyeccion_ != nullptr) {
+        CloseHandle((HANDLE)manejadorProyeccion_);
+    }
+    if (manejadorArchivo_ != nullptr) {
+        CloseHandle((HANDLE)manejadorArchivo_);
+    }
+    datos_ = nullptr;
+    tamano_ = 0;
+    manejadorProyeccion_ = nullptr;
+    manejadorArchivo_ = nullptr;
+}
+
+void ArchivoMapeado::avisarLecturaSecuencial(size_t, size_t) const {
+    // FILE_FLAG_SEQUENTIAL_SCAN ya se indicó al abrir el archivo
+}
+
+void ArchivoMapeado::descartarRango(size_t, size_t) const {
+    // Windows recorta el conjunto de trabajo por sí mismo con FILE_FLAG_SEQUENTIAL_SCAN
+}
+
+#else
+
+ArchivoMapeado::ArchivoMapeado(const std::string& nombreArchivo) {
+    int descriptor = ::open(nombreArchivo.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("No se pudo abrir el archivo: " + nombreArchivo);
+    }
+
+    struct stat estado;
+    if (::fstat(descriptor, &estado) != 0) {
+        ::close(descriptor);
+        throw std::runtime_error("No se pudo obtener el tamaño de: " + nombreArchivo);
+    }
+    tamano_ = (size_t)estado.st_size;
+
+    // Un archivo vacío no se puede proyectar; se representa como vista vacía
+    if (tamano_ > 0) {
+        void* proyeccion = ::mmap(nullptr, tamano_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (proyeccion == MAP_FAILED) {
+            ::close(descriptor);
+            tamano_ = 0;
+            throw std::runtime_error("No se pudo proyectar en memoria: " + nombreArchivo);
+        }
+        datos_ = (const unsigned char*)proyeccion;
+    }
+
+    // La proyección sigue siendo válida después de cerrar el descriptor
+    ::close(descriptor);
+}
+
+void ArchivoMapeado::liberar() {
+    if (datos_ != nullptr) {
+        ::munmap((void*)datos_, tamano_);
+    }
+    datos_ = nullptr;
+    tamano_ = 0;
+}
+
+void ArchivoMapeado::avisarLecturaSecuencial(size_t inicio, size_t longitud) const {
+    if (datos_ == nullptr || inicio >= tamano_) {
+        return;
+    }
+
+    // madvise exige una dirección alineada a página
+    size_t pagina = (size_t)::sysconf(_SC_PAGESIZE);
+    size_t inicioAlineado = inicio - inicio % pagina;
+    size_t fin = inicio + longitud < tamano_ ? inicio + longitud : tamano_;
+    ::madvise((void*)(datos_ + inicioAlineado), fin - inicioAlineado, MADV_SEQUENTIAL);
+}
+
+void ArchivoMapeado::descartarRango(size_t inicio, size_t longitud) const {
+    if (datos_ == nullptr || inicio >= tamano_) {
+        return;
+    }
+
+    // Sólo páginas completamente contenidas en el rango
+    size_t pagina = (size_t)::sysconf(_SC_PAGESIZE);
+    size_t fin = inicio + longitud < tamano_ ? inicio + longitud : tamano_;
+    size_t inicioAlineado = (inicio + pagina - 1) / pagina * pagina;
+    size_t finAlineado = fin / pagina * pagina;
+    if (finAlineado > inicioAlineado) {
+        ::madvise((void*)(datos_ + inicioAlineado), finAlineado - inicioAlineado, MADV_DONTNEED);
+    }
+}
+
+#endif
+
+ArchivoMapeado::~ArchivoMapeado() {
+    liberar();
+}
+
+ArchivoMapeado::ArchivoMapeado(ArchivoMapeado&& otro) noexcept {
+    *this = std::move(otro);
+}
+
+ArchivoMapeado& ArchivoMapeado::operator=(ArchivoMapeado&& otro) noexcept {
+    if (this != &otro) {
+        liberar();
+        std::swap(datos_, otro.datos_);
+        std::swap(tamano_, otro.tamano_);
+#ifdef _WIN32
+        std::swap(manejadorArchivo_, otro.manejadorArchivo_);
+        std::swap(manejadorProyeccion_, otro.manejadorProyeccion_);
+#endif
+    }
+    return *this;
+}
@@ -0,0 +1,48 @@
+#ifndef ARCHIVO_MAPEADO_H
+#define ARCHIVO_MAPEADO_H
+
+#include <cstddef>
+#include <string>
+#include "../utilidades/Vista.h"
+
+// Archivo proyectado en memoria en modo sólo lectura (mmap en POSIX,
+// MapViewOfFile en Windows). El contenido se lee directamente de la caché de
+// páginas del sistema operativo, sin copiarlo a un búfer propio: las páginas
+// se cargan bajo demanda y el sistema puede descartarlas en cualquier
+// momento, así que leer archivos de varios GB no aumenta la memoria residente
+// del proceso más allá de lo que realmente se está usando.
+class ArchivoMapeado {
+public:
+    explicit ArchivoMapeado(const std::string& nombreArchivo);
+    ~ArchivoMapeado();
+
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+    ArchivoMapeado(ArchivoMapeado&& otro) noexcept;
+    ArchivoMapeado& operator=(ArchivoMapeado&& otro) noexcept;
+
+    // Contenido completo del archivo
+    Vista<unsigned char> contenido() const { return Vista<unsigned char>(datos_, tamano_); }
+    const unsigned char* datos() const { return datos_; }
+    size_t tamano() const { return tamano_; }
+
+    // Indicar al sistema que el rango se leerá de forma secuencial (lectura
+    // anticipada más agresiva y liberación temprana de páginas ya leídas)
+    void avisarLecturaSecuencial(size_t inicio, size_t longitud) const;
+
+    // Devolver al sistema las páginas completas del rango que ya no se van a
+    // leer (se volverían a cargar del archivo si se accede de nuevo)
+    void descartarRango(size_t inicio, size_t longitud) const;
+
+private:
+    void liberar();
+
+    const unsigned char* datos_ = nullptr;
+    size_t tamano_ = 0;
+#ifdef _WIN32
+    void* manejadorArchivo_ = nullptr;
+    void* manejadorProyeccion_ = nullptr;
+#endif
+};
+
+#endif
@@ -0,0 +1,147 @@
+#include "ArchivoWAV.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+// Lectura de enteros little-endian en posiciones sin alinear
+uint16_t leer16(const unsigned char* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t leer32(const unsigned char* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+}
+
+ArchivoWAV::ArchivoWAV(const std::string& nombreArchivo)
+    : archivo_(nombreArchivo) {
+    const unsigned char* base = archivo_.datos();
+    size_t tamanoArchivo = archivo_.tamano();
+
+    // Encabezado RIFF (12 bytes)
+    if (tamanoArchivo < 12 ||
+        std::memcmp(base, "RIFF", 4) != 0 ||
+        std::memcmp(base + 8, "WAVE", 4) != 0) {
+        throw std::runtime_error("No es un archivo WAV válido: " + nombreArchivo);
+    }
+
+    bool formatoEncontrado = false;
+    bool datosEncontrados = false;
+
+    // Recorrer la tabla de chunks: cada uno tiene id (4 bytes), tamaño
+    // (4 bytes) y contenido, rellenado a un número par de bytes
+    size_t posicion = 12;
+    while (posicion + 8 <= tamanoArchivo) {
+        Chunk chunk;
+        chunk.id.assign((const char*)base + posicion, 4);
+        chunk.tamano = leer32(base + posicion + 4);
+        chunk.posicion = posicion + 8;
+        chunks_.push_back(chunk);
+
+        size_t disponibles = tamanoArchivo - chunk.posicion;
+
+        if (chunk.id == "fmt ") {
+            if (chunk.tamano < 16 || disponibles < 16) {
+                throw std::runtime_error("Error al leer chunk fmt");
+            }
+
+            const unsigned char* fmt = base + chunk.posicion;
+            formato_.formatoAudio = leer16(fmt);
+            formato_.numeroCanales = leer16(fmt + 2);
+            formato_.frecuenciaMuestreo = (int)leer32(fmt + 4);
+            formato_.byteRate = (int)leer32(fmt + 8);
+            formato_.bloqueAlineado = leer16(fmt + 12);
+            formato_.bitsPorMuestra = leer16(fmt + 14);
+            formato_.bitsValidos = formato_.bitsPorMuestra;
+
+            // WAVE_FORMAT_EXTENSIBLE: el formato real está en los dos primeros
+            // bytes del GUID del subformato
+            if (formato_.formatoAudio == FormatoWAV::extensible) {
+                if (chunk.tamano < 40 || disponibles < 40) {
+                    throw std::runtime_error("Chunk fmt extensible incompleto");
+                }
+                formato_.esExtensible = true;
+                formato_.bitsValidos = leer16(fmt + 18);
+                formato_.mascaraCanales = leer32(fmt + 20);
+                formato_.formatoAudio = leer16(fmt + 24);
+                if (formato_.bitsValidos == 0) {
+                    formato_.bitsValidos = formato_.bitsPorMuestra;
+                }
+            }
+            formatoEncontrado = true;
+
+        } else if (chunk.id == "data") {
+            tamanoDeclarado_ = chunk.tamano;
+            size_t tamanoDatos = chunk.tamano;
+            if (tamanoDatos > disponibles) {
+                tamanoDatos = disponibles;
+                truncado_ = true;
+            }
+            datos_ = Vista<unsigned char>(base + chunk.posicion, tamanoDatos);
+            datosEncontrados = true;
+
+            // Si ya tenemos formato y datos no hace falta seguir
+            if (formatoEncontrado) {
+                break;
+            }
+        }
+
+        posicion = chunk.posicion + (size_t)chunk.tamano + (chunk.tamano % 2);
+    }
+
+    if (!formatoEncontrado) {
+        throw std::runtime_error("No se encontró el chunk de formato (fmt) en el archivo WAV");
+    }
+
+    if (!datosEncontrados || datos_.empty()) {
+        throw std::runtime_error("No se encontró el chunk de datos (data) en el archivo WAV");
+    }
+
+    if (formato_.numeroCanales <= 0) {
+        throw std::runtime_error("Número de canales inválido en el archivo WAV");
+    }
+}
+
+NucleosAudio::TipoMuestra ArchivoWAV::tipoMuestra() const {
+    using TipoMuestra = NucleosAudio::TipoMuestra;
+
+    // Con menos bits válidos que el contenedor (p. ej. 20 en 24 o 24 en 32)
+    // las muestras están alineadas a la izquierda, así que basta con decodificar
+    // el contenedor
+    if (formato_.formatoAudio == FormatoWAV::pcm) {
+        switch (formato_.bitsPorMuestra) {
+            case 8:  return TipoMuestra::Entero8;
+            case 16: return TipoMuestra::Entero16;
+            case 24: return TipoMuestra::Entero24;
+            case 32: return TipoMuestra::Entero32;
+        }
+    } else if (formato_.formatoAudio == FormatoWAV::flotanteIEEE) {
+        switch (formato_.bitsPorMuestra) {
+            case 32: return TipoMuestra::Flotante32;
+            case 64: return TipoMuestra::Flotante64;
+        }
+    } else {
+        throw std::runtime_error("Solo se soporta formato PCM o flotante IEEE (formato=" +
+                                 std::to_string(formato_.formatoAudio) + ")");
+    }
+
+    throw std::runtime_error("Tamaño de muestra no soportado: " + std::to_string(formato_.bitsPorMuestra) +
+                             " bits (formato=" + std::to_string(formato_.formatoAudio) + ")");
+}
+
+size_t ArchivoWAV::bytesPorTrama() const {
+    return (size_t)formato_.numeroCanales * ((formato_.bitsPorMuestra + 7) / 8);
+}
+
+size_t ArchivoWAV::numeroTramas() const {
+    size_t bytes = bytesPorTrama();
+    return bytes > 0 ? datos_.tamano / bytes : 0;
+}
+
+void ArchivoWAV::avisarLecturaSecuencial() const {
+    archivo_.avisarLecturaSecuencial(datos_.datos - archivo_.datos(), datos_.tamano);
+}
+
+void ArchivoWAV::descartarDatos(size_t inicio, size_t longitud) const {
+    archivo_.descartarRango((datos_.datos - archivo_.datos()) + inicio, longitud);
+}
@@ -0,0 +1,81 @@
+#ifndef ARCHIVO_WAV_H
+#define ARCHIVO_WAV_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ArchivoMapeado.h"
+#include "NucleosAudio.h"
+#include "../utilidades/Vista.h"
+
+// Campos del chunk "fmt " de un archivo WAV
+struct FormatoWAV {
+    // Códigos de formato de audio
+    static constexpr int pcm = 1;
+    static constexpr int flotanteIEEE = 3;
+    static constexpr int extensible = 0xFFFE;
+
+    int formatoAudio = 0;           // pcm o flotanteIEEE (con WAVE_FORMAT_EXTENSIBLE, el del subformato)
+    int numeroCanales = 0;
+    int frecuenciaMuestreo = 0;
+    int byteRate = 0;
+    int bloqueAlineado = 0;         // Bytes por trama (todas las muestras de un instante)
+    int bitsPorMuestra = 0;         // Tamaño del contenedor de cada muestra
+    int bitsValidos = 0;            // Bits significativos (<= bitsPorMuestra)
+    bool esExtensible = false;      // Cabecera WAVE_FORMAT_EXTENSIBLE
+    uint32_t mascaraCanales = 0;    // Posición de los altavoces (sólo extensible)
+};
+
+// Archivo WAV proyectado en memoria. La tabla de chunks RIFF se analiza en el
+// sitio, sin leer ni copiar el audio: la carga útil PCM del chunk "data" se
+// expone como una vista sobre la proyección, válida mientras viva el objeto.
+class ArchivoWAV {
+public:
+    // Chunk RIFF encontrado en el archivo (para diagnóstico)
+    struct Chunk {
+        std::string id;
+        size_t posicion;            // Desplazamiento del contenido dentro del archivo
+        uint32_t tamano;            // Tamaño declarado en la cabecera del chunk
+    };
+
+    // Proyectar el archivo y analizar sus chunks. Lanza std::runtime_error si
+    // no es un RIFF/WAVE válido o le falta el chunk "fmt " o "data".
+    explicit ArchivoWAV(const std::string& nombreArchivo);
+
+    const FormatoWAV& formato() const { return formato_; }
+    const std::vector<Chunk>& chunks() const { return chunks_; }
+
+    // Bytes de la carga útil del chunk "data", sin copia
+    Vista<unsigned char> datos() const { return datos_; }
+
+    // Codificación de las muestras. Lanza std::runtime_error si el formato
+    // no está soportado (PCM de 8/16/24/32 bits o flotante de 32/64 bits).
+    NucleosAudio::TipoMuestra tipoMuestra() const;
+
+    // Bytes por trama según el contenedor de las muestras
+    size_t bytesPorTrama() const;
+
+    // Número de tramas completas (muestras por canal) en el chunk "data"
+    size_t numeroTramas() const;
+
+    // El chunk "data" declara más bytes de los que contiene el archivo
+    bool truncado() const { return truncado_; }
+    uint32_t tamanoDeclarado() const { return tamanoDeclarado_; }
+
+    // Indicar al sistema que la carga útil se leerá de principio a fin
+    void avisarLecturaSecuencial() const;
+
+    // Devolver al sistema las páginas de la carga útil ya consumidas
+    // (desplazamientos relativos al inicio del chunk "data")
+    void descartarDatos(size_t inicio, size_t longitud) const;
+
+private:
+    ArchivoMapeado archivo_;
+    FormatoWAV formato_;
+    std::vector<Chunk> chunks_;
+    Vista<unsigned char> datos_;
+    uint32_t tamanoDeclarado_ = 0;
+    bool truncado_ = false;
+};
+
+#endif
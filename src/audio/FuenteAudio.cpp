@@ -0,0 +1,197 @@
+#include "FuenteAudio.h"
+#include "NucleosAudio.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+// ===== FuenteAudio =====
+
+FuenteAudio::FuenteAudio(int frecuenciaMuestreo, int numeroCanales, int bitsPorMuestra)
+    : frecuenciaMuestreo_(frecuenciaMuestreo),
+      numeroCanales_(numeroCanales),
+      bitsPorMuestra_(bitsPorMuestra) {
+    if (frecuenciaMuestreo <= 0 || numeroCanales <= 0) {
+        throw std::invalid_argument("La fuente de audio necesita frecuencia de muestreo y canales positivos");
+    }
+}
+
+size_t FuenteAudio::leer(float* destino, size_t maximo) {
+    size_t leidas = leerMuestras(destino, maximo);
+    muestrasLeidas_ += leidas;
+    return leidas;
+}
+
+bool FuenteAudio::siguienteBloque(std::vector<float>& bloque) {
+    bloque.resize(tamanoBloque_);
+
+    // Una lectura puede devolver menos muestras de las pedidas (tuberías)
+    size_t total = 0;
+    while (total < tamanoBloque_) {
+        size_t leidas = leer(bloque.data() + total, tamanoBloque_ - total);
+        if (leidas == 0) {
+            break;
+        }
+        total += leidas;
+    }
+
+    bloque.resize(total);
+    return total > 0;
+}
+
+// ===== FuenteWAV =====
+
+FuenteWAV::FuenteWAV(const std::string& nombreArchivo)
+    : FuenteWAV(ArchivoWAV(nombreArchivo)) {
+}
+
+FuenteWAV::FuenteWAV(ArchivoWAV archivo)
+    : FuenteAudio(archivo.formato().frecuenciaMuestreo, archivo.formato().numeroCanales,
+                  archivo.formato().bitsPorMuestra),
+      archivo_(std::move(archivo)),
+      tipo_(archivo_.tipoMuestra()) {
+    archivo_.avisarLecturaSecuencial();
+}
+
+size_t FuenteWAV::leerMuestras(float* destino, size_t maximo) {
+    const int canales = archivo_.formato().numeroCanales;
+    const size_t bytesPorTrama = archivo_.bytesPorTrama();
+    size_t tramas = std::min(maximo, archivo_.numeroTramas() - siguienteTrama_);
+    const unsigned char* crudas = archivo_.datos().begin() + siguienteTrama_ * bytesPorTrama;
+
+    // Decodificar, normalizar y mezclar a mono en una sola pasada
+    NucleosAudio::activos().convertir(tipo_, crudas, destino, tramas, canales);
+    siguienteTrama_ += tramas;
+
+    // Devolver al sistema las páginas ya decodificadas
+    size_t bytesConsumidos = siguienteTrama_ * bytesPorTrama;
+    archivo_.descartarDatos(bytesDescartados_, bytesConsumidos - bytesDescartados_);
+    bytesDescartados_ = bytesConsumidos;
+
+    return tramas;
+}
+
+// ===== FuenteFLAC =====
+
+namespace {
+// Bytes comprimidos que decodifica cada hilo por lote
+constexpr size_t bytesLoteFLAC = 256 * 1024;
+}
+
+FuenteFLAC::FuenteFLAC(const std::string& nombreArchivo, int hilos)
+    : FuenteFLAC(ArchivoFLAC(nombreArchivo), hilos) {
+}
+
+FuenteFLAC::FuenteFLAC(ArchivoFLAC archivo, int hilos)
+    : FuenteAudio(archivo.info().frecuenciaMuestreo, archivo.info().numeroCanales,
+                  archivo.info().bitsPorMuestra),
+      archivo_(std::move(archivo)),
+      hilos_(hilos > 0 ? hilos : (int)std::max(1u, std::thread::hardware_concurrency())),
+      siguienteTrama_(archivo_.inicioTramas()) {
+    archivo_.avisarLecturaSecuencial();
+}
+
+long long FuenteFLAC::totalMuestras() const {
+    uint64_t total = archivo_.info().totalMuestras;
+    return total > 0 ? (long long)total : -1;
+}
+
+size_t FuenteFLAC::leerMuestras(float* destino, size_t maximo) {
+    while (posicionPendientes_ == pendientes_.size() && siguienteTrama_ < archivo_.tamano()) {
+        pendientes_.clear();
+        posicionPendientes_ = 0;
+
+        size_t inicio = siguienteTrama_;
+        siguienteTrama_ = archivo_.decodificar(inicio, inicio + bytesLoteFLAC * hilos_, hilos_, pendientes_);
+
+        // Devolver al sistema las páginas del lote ya decodificado
+        archivo_.descartarDatos(inicio, siguienteTrama_ - inicio);
+    }
+
+    size_t cantidad = std::min(maximo, pendientes_.size() - posicionPendientes_);
+    std::copy(pendientes_.begin() + posicionPendientes_,
+              pendientes_.begin() + posicionPendientes_ + cantidad, destino);
+    posicionPendientes_ += cantidad;
+    return cantidad;
+}
+
+// ===== FuenteEntradaEstandar =====
+
+FuenteEntradaEstandar::FuenteEntradaEstandar(int frecuenciaMuestreo, int numeroCanales,
+                                             NucleosAudio::TipoMuestra tipo)
+    : FuenteAudio(frecuenciaMuestreo, numeroCanales, 8 * NucleosAudio::bytesPorMuestra(tipo)),
+      entrada_(stdin),
+      tipo_(tipo) {
+#ifdef _WIN32
+    _setmode(_fileno(stdin), _O_BINARY);
+#endif
+}
+
+size_t FuenteEntradaEstandar::leerMuestras(float* destino, size_t maximo) {
+    const int canales = numeroCanales();
+    const size_t bytesPorTrama = (size_t)canales * NucleosAudio::bytesPorMuestra(tipo_);
+    crudas_.resize(maximo * bytesPorTrama);
+
+    // Leer tramas completas; fread sólo devuelve menos al llegar al final
+    size_t tramas = std::fread(crudas_.data(), bytesPorTrama, maximo, entrada_);
+
+    NucleosAudio::activos().convertir(tipo_, crudas_.data(), destino, tramas, canales);
+
+    return tramas;
+}
+
+// ===== FuenteMemoria =====
+
+FuenteMemoria::FuenteMemoria(DatosAudio audio)
+    : FuenteAudio(audio.frecuenciaMuestreo, 1, audio.bitsPorMuestra),
+      audio_(std::move(audio)) {
+    if (audio_.numeroCanales != 1) {
+        throw std::invalid_argument("FuenteMemoria espera audio mono (leerWAV ya lo convierte)");
+    }
+}
+
+size_t FuenteMemoria::leerMuestras(float* destino, size_t maximo) {
+    size_t cantidad = std::min(maximo, audio_.muestras.size() - posicion_);
+    std::copy(audio_.muestras.begin() + posicion_, audio_.muestras.begin() + posicion_ + cantidad, destino);
+    posicion_ += cantidad;
+    return cantidad;
+}
+
+// ===== FuenteRemuestreada =====
+
+FuenteRemuestreada::FuenteRemuestreada(std::unique_ptr<FuenteAudio> origen,
+                                       const Remuestreador::Configuracion& config)
+    : FuenteAudio(config.frecuenciaDestino, origen->numeroCanales(), origen->bitsPorMuestra()),
+      origen_(std::move(origen)),
+      remuestreador_(origen_->frecuenciaMuestreo(), config) {
+}
+
+long long FuenteRemuestreada::totalMuestras() const {
+    long long total = origen_->totalMuestras();
+    return total < 0 ? -1 : (long long)remuestreador_.muestrasSalida((size_t)total);
+}
+
+size_t FuenteRemuestreada::leerMuestras(float* destino, size_t maximo) {
+    // Remuestrear bloques del origen hasta tener algo que entregar
+    while (posicionPendientes_ == pendientes_.size() && !terminada_) {
+        pendientes_.clear();
+        posicionPendientes_ = 0;
+        if (origen_->siguienteBloque(entrada_)) {
+            remuestreador_.procesar(entrada_.data(), entrada_.size(), pendientes_);
+        } else {
+            remuestreador_.finalizar(pendientes_);
+            terminada_ = true;
+        }
+    }
+
+    size_t cantidad = std::min(maximo, pendientes_.size() - posicionPendientes_);
+    std::copy(pendientes_.begin() + posicionPendientes_,
+              pendientes_.begin() + posicionPendientes_ + cantidad, destino);
+    posicionPendientes_ += cantidad;
+    return cantidad;
+}
@@ -0,0 +1,156 @@
+#ifndef FUENTE_AUDIO_H
+#define FUENTE_AUDIO_H
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ArchivoFLAC.h"
+#include "ArchivoWAV.h"
+#include "LectorAudio.h"
+#include "NucleosAudio.h"
+#include "Remuestreador.h"
+
+// Fuente de audio por demanda: entrega muestras mono normalizadas a
+// [-1.0, 1.0] en bloques de tamaño fijo, de modo que el espectrograma, la
+// detección de picos y los hashes pueden recorrer entradas de cualquier
+// duración con memoria acotada (ver Espectrograma::calcularPorBloques).
+class FuenteAudio {
+public:
+    static constexpr size_t tamanoBloquePredeterminado = 65536;
+
+    virtual ~FuenteAudio() = default;
+
+    // Leer hasta 'maximo' muestras. Devuelve cuántas se leyeron (0 al terminar).
+    size_t leer(float* destino, size_t maximo);
+
+    // Llenar 'bloque' con las siguientes tamanoBloque() muestras (el último
+    // bloque puede ser más corto). Devuelve false si ya no quedan muestras.
+    bool siguienteBloque(std::vector<float>& bloque);
+
+    int frecuenciaMuestreo() const { return frecuenciaMuestreo_; }
+    int numeroCanales() const { return numeroCanales_; }    // De la señal original (se entrega en mono)
+    int bitsPorMuestra() const { return bitsPorMuestra_; }
+    size_t tamanoBloque() const { return tamanoBloque_; }
+    void establecerTamanoBloque(size_t tamano) { tamanoBloque_ = tamano > 0 ? tamano : 1; }
+
+    // Muestras entregadas hasta ahora y su duración en segundos
+    size_t muestrasLeidas() const { return muestrasLeidas_; }
+    double duracionLeida() const { return (double)muestrasLeidas_ / frecuenciaMuestreo_; }
+
+    // Total de muestras de la fuente, o -1 si no se conoce de antemano (stdin)
+    virtual long long totalMuestras() const { return -1; }
+
+protected:
+    FuenteAudio(int frecuenciaMuestreo, int numeroCanales, int bitsPorMuestra);
+
+    // Implementación de leer() en cada fuente
+    virtual size_t leerMuestras(float* destino, size_t maximo) = 0;
+
+private:
+    int frecuenciaMuestreo_;
+    int numeroCanales_;
+    int bitsPorMuestra_;
+    size_t tamanoBloque_ = tamanoBloquePredeterminado;
+    size_t muestrasLeidas_ = 0;
+};
+
+// Archivo WAV proyectado en memoria. Cada bloque se decodifica directamente
+// desde la proyección y las páginas ya consumidas se devuelven al sistema, así
+// que la memoria residente no crece con el tamaño del archivo.
+class FuenteWAV : public FuenteAudio {
+public:
+    explicit FuenteWAV(const std::string& nombreArchivo);
+    explicit FuenteWAV(ArchivoWAV archivo);
+
+    long long totalMuestras() const override { return (long long)archivo_.numeroTramas(); }
+
+protected:
+    size_t leerMuestras(float* destino, size_t maximo) override;
+
+private:
+    ArchivoWAV archivo_;
+    NucleosAudio::TipoMuestra tipo_;
+    size_t siguienteTrama_ = 0;
+    size_t bytesDescartados_ = 0;
+};
+
+// Archivo FLAC decodificado por lotes de tramas: cada lote se reparte entre
+// varios hilos y las páginas ya decodificadas se devuelven al sistema.
+class FuenteFLAC : public FuenteAudio {
+public:
+    // hilos = 0: uno por núcleo
+    explicit FuenteFLAC(const std::string& nombreArchivo, int hilos = 0);
+    explicit FuenteFLAC(ArchivoFLAC archivo, int hilos = 0);
+
+    long long totalMuestras() const override;
+
+protected:
+    size_t leerMuestras(float* destino, size_t maximo) override;
+
+private:
+    ArchivoFLAC archivo_;
+    int hilos_;
+    size_t siguienteTrama_;
+    std::vector<float> pendientes_;     // Muestras decodificadas aún no entregadas
+    size_t posicionPendientes_ = 0;
+};
+
+// PCM crudo little-endian entrelazado leído de la entrada estándar (p. ej.
+// la salida de arecord o ffmpeg -f s16le), sin cabecera: el formato se indica
+// al construir la fuente.
+class FuenteEntradaEstandar : public FuenteAudio {
+public:
+    FuenteEntradaEstandar(int frecuenciaMuestreo, int numeroCanales,
+                          NucleosAudio::TipoMuestra tipo = NucleosAudio::TipoMuestra::Entero16);
+
+protected:
+    size_t leerMuestras(float* destino, size_t maximo) override;
+
+private:
+    std::FILE* entrada_;
+    NucleosAudio::TipoMuestra tipo_;
+    std::vector<unsigned char> crudas_;
+};
+
+// Muestras mono que ya están en memoria (p. ej. el resultado de un prefiltro)
+class FuenteMemoria : public FuenteAudio {
+public:
+    explicit FuenteMemoria(DatosAudio audio);
+
+    long long totalMuestras() const override { return (long long)audio_.muestras.size(); }
+
+protected:
+    size_t leerMuestras(float* destino, size_t maximo) override;
+
+private:
+    DatosAudio audio_;
+    size_t posicion_ = 0;
+};
+
+// Otra fuente llevada a una frecuencia de análisis común con un
+// Remuestreador polifásico, bloque a bloque y sin leerla entera
+class FuenteRemuestreada : public FuenteAudio {
+public:
+    FuenteRemuestreada(std::unique_ptr<FuenteAudio> origen,
+                       const Remuestreador::Configuracion& config = Remuestreador::Configuracion());
+
+    long long totalMuestras() const override;
+
+    const FuenteAudio& origen() const { return *origen_; }
+    const Remuestreador& remuestreador() const { return remuestreador_; }
+
+protected:
+    size_t leerMuestras(float* destino, size_t maximo) override;
+
+private:
+    std::unique_ptr<FuenteAudio> origen_;
+    Remuestreador remuestreador_;
+    std::vector<float> entrada_;
+    std::vector<float> pendientes_;     // Salidas calculadas aún no entregadas
+    size_t posicionPendientes_ = 0;
+    bool terminada_ = false;
+};
+
+#endif
@@ -1,225 +1,174 @@
 // src/audio/LectorAudio.cpp
 #include "LectorAudio.h"
+#include "ArchivoFLAC.h"
+#include "ArchivoWAV.h"
+#include "FuenteAudio.h"
+#include "NucleosAudio.h"
 #include <cstdint>
 #include <iostream>
-#include <fstream>
 #include <cstring>
 #include <stdexcept>
 #include <algorithm>
+#include <cctype>
+#include <thread>
 #include <iomanip> 
 
 DatosAudio LectorAudio::leerWAV(const std::string& nombreArchivo) {
     DatosAudio datosAudio;
-    std::ifstream archivo(nombreArchivo, std::ios::binary);
     
-    if (!archivo.is_open()) {
-        throw std::runtime_error("No se pudo abrir el archivo: " + nombreArchivo);
-    }
+    // Proyectar el archivo en memoria y analizar los chunks en el sitio: el
+    // audio no se lee a un búfer intermedio, se decodifica directamente desde
+    // la caché de páginas al vector de salida
+    ArchivoWAV archivo(nombreArchivo);
     
     std::cout << "[DEBUG] Archivo abierto correctamente" << std::endl;
+    std::cout << "[DEBUG] Encabezado RIFF válido" << std::endl;
     
-    // Leer encabezado RIFF (12 bytes)
-    char encabezadoRIFF[12];
-    archivo.read(encabezadoRIFF, 12);
-    
-    if (!archivo) {
-        throw std::runtime_error("Error al leer encabezado RIFF");
+    for (const ArchivoWAV::Chunk& chunk : archivo.chunks()) {
+        std::cout << "[DEBUG] Chunk encontrado: " << chunk.id
+                  << " (tamaño: " << chunk.tamano << " bytes)" << std::endl;
     }
     
-    // Verificar que sea un archivo RIFF WAV
-    if (std::strncmp(encabezadoRIFF, "RIFF", 4) != 0 ||
-        std::strncmp(encabezadoRIFF + 8, "WAVE", 4) != 0) {
-        throw std::runtime_error("No es un archivo WAV válido");
+    const FormatoWAV& formato = archivo.formato();
+    datosAudio.numeroCanales = formato.numeroCanales;
+    datosAudio.frecuenciaMuestreo = formato.frecuenciaMuestreo;
+    datosAudio.bitsPorMuestra = formato.bitsPorMuestra;
+    
+    std::cout << "[DEBUG] Formato de audio: " << formato.formatoAudio << std::endl;
+    std::cout << "[DEBUG] Block align: " << formato.bloqueAlineado << std::endl;
+    std::cout << "[DEBUG] Byte rate: " << formato.byteRate << std::endl;
+    
+    // Codificación de las muestras (PCM de 8/16/24/32 bits o flotante IEEE,
+    // también con cabecera WAVE_FORMAT_EXTENSIBLE)
+    NucleosAudio::TipoMuestra tipo = archivo.tipoMuestra();
+    int bytesMuestra = NucleosAudio::bytesPorMuestra(tipo);
+    if (formato.esExtensible) {
+        std::cout << "[DEBUG] WAVE_FORMAT_EXTENSIBLE: " << formato.bitsValidos << " bits válidos, máscara de canales 0x"
+                  << std::hex << formato.mascaraCanales << std::dec << std::endl;
     }
     
-    std::cout << "[DEBUG] Encabezado RIFF válido" << std::endl;
+    // Carga útil leída directamente de la proyección
+    Vista<unsigned char> datos = archivo.datos();
+    int numeroCanales = formato.numeroCanales;
+    size_t numeroTramas = archivo.numeroTramas();
+    size_t totalMuestras = numeroTramas * numeroCanales;
+    datosAudio.duracion = (double)numeroTramas / datosAudio.frecuenciaMuestreo;
     
-    // Variables para almacenar información del formato
-    bool formatoEncontrado = false;
-    bool datosEncontrados = false;
-    int32_t tamanoDatos = 0;
-    std::streampos posicionDatos = 0;
+    std::cout << "[DEBUG] Total de muestras a leer: " << totalMuestras << std::endl;
+    std::cout << "[DEBUG] Bytes por muestra: " << bytesMuestra << std::endl;
+    std::cout << "[DEBUG] Tamaño del chunk data: " << archivo.tamanoDeclarado() << " bytes" << std::endl;
     
-    // Buscar chunks "fmt " y "data"
-    char chunkID[4];
-    int32_t chunkSize;
+    if (archivo.truncado()) {
+        std::cerr << "[ADVERTENCIA] El archivo contiene " << datos.size()
+                  << " bytes de " << archivo.tamanoDeclarado() << " esperados" << std::endl;
+    }
     
-    while (archivo.read(chunkID, 4)) {
-        if (!archivo.read((char*)&chunkSize, 4)) {
-            break;
-        }
-        
-        std::cout << "[DEBUG] Chunk encontrado: " 
-                  << chunkID[0] << chunkID[1] << chunkID[2] << chunkID[3] 
-                  << " (tamaño: " << chunkSize << " bytes)" << std::endl;
+    // *** DIAGNÓSTICO CRÍTICO: Mostrar muestras crudas ***
+    // Las primeras muestras de todos los canales, normalizadas una a una
+    const NucleosAudio::Tabla& nucleos = NucleosAudio::activos();
+    std::vector<float> primeras(std::min((size_t)10000, totalMuestras));
+    nucleos.convertir(tipo, datos.begin(), primeras.data(), primeras.size(), 1);
+    
+    std::cout << "[DEBUG] Primeras 20 muestras crudas:" << std::endl;
+    for (size_t i = 0; i < std::min((size_t)20, primeras.size()); i++) {
+        std::cout << "  RAW[" << i << "] = " << std::setw(10) << primeras[i] << " (hex: 0x" << std::hex << std::setfill('0');
         
-        if (std::strncmp(chunkID, "fmt ", 4) == 0) {
-            // Leer información del formato
-            int16_t formatoAudio;
-            int16_t numeroCanales;
-            int32_t frecuenciaMuestreo;
-            int32_t byteRate;
-            int16_t blockAlign;
-            int16_t bitsPorMuestra;
-            
-            archivo.read((char*)&formatoAudio, 2);
-            archivo.read((char*)&numeroCanales, 2);
-            archivo.read((char*)&frecuenciaMuestreo, 4);
-            archivo.read((char*)&byteRate, 4);
-            archivo.read((char*)&blockAlign, 2);
-            archivo.read((char*)&bitsPorMuestra, 2);
-            
-            if (!archivo) {
-                throw std::runtime_error("Error al leer chunk fmt");
-            }
-            
-            datosAudio.numeroCanales = numeroCanales;
-            datosAudio.frecuenciaMuestreo = frecuenciaMuestreo;
-            datosAudio.bitsPorMuestra = bitsPorMuestra;
-            
-            std::cout << "[DEBUG] Formato de audio: " << formatoAudio << std::endl;
-            std::cout << "[DEBUG] Block align: " << blockAlign << std::endl;
-            std::cout << "[DEBUG] Byte rate: " << byteRate << std::endl;
-            
-            // Verificar formato PCM
-            if (formatoAudio != 1) {
-                throw std::runtime_error("Solo se soporta formato PCM (formato=" + std::to_string(formatoAudio) + ")");
-            }
-            
-            // Saltar bytes extra del chunk fmt si los hay
-            int bytesLeidos = 16;
-            int bytesRestantes = chunkSize - bytesLeidos;
-            if (bytesRestantes > 0) {
-                archivo.seekg(bytesRestantes, std::ios::cur);
-            }
-            
-            formatoEncontrado = true;
-            std::cout << "[DEBUG] Chunk fmt procesado correctamente" << std::endl;
-            
-        } else if (std::strncmp(chunkID, "data", 4) == 0) {
-            tamanoDatos = chunkSize;
-            posicionDatos = archivo.tellg();
-            datosEncontrados = true;
-            
-            std::cout << "[DEBUG] Chunk data encontrado en posición " 
-                      << posicionDatos << std::endl;
-            
-            // No leer los datos aún, solo marcar la posición
-            archivo.seekg(chunkSize, std::ios::cur);
-            
-            // Si ya tenemos formato y datos, podemos salir
-            if (formatoEncontrado) {
-                break;
-            }
-            
-        } else {
-            // Saltar este chunk desconocido
-            int padding = chunkSize % 2;
-            std::cout << "[DEBUG] Saltando chunk desconocido (+" 
-                      << chunkSize << " bytes, padding: " << padding << ")" << std::endl;
-            
-            archivo.seekg(chunkSize + padding, std::ios::cur);
-            
-            if (!archivo) {
-                std::cout << "[DEBUG] Fin de archivo alcanzado" << std::endl;
-                break;
-            }
+        // Bytes de la muestra en orden little-endian, como entero en hexadecimal
+        for (int b = bytesMuestra - 1; b >= 0; b--) {
+            std::cout << std::setw(2) << (int)datos[i * bytesMuestra + b];
         }
+        std::cout << std::dec << std::setfill(' ') << ")" << std::endl;
     }
     
-    if (!formatoEncontrado) {
-        throw std::runtime_error("No se encontró el chunk de formato (fmt) en el archivo WAV");
-    }
+    // Verificar si todas son silencio
+    auto primeroNoCero = std::find_if(primeras.begin(), primeras.end(), [](float m) { return m != 0.0f; });
     
-    if (!datosEncontrados || tamanoDatos <= 0) {
-        throw std::runtime_error("No se encontró el chunk de datos (data) en el archivo WAV");
+    if (primeroNoCero == primeras.end()) {
+        std::cout << "[ERROR CRÍTICO] ¡Las primeras " << primeras.size() << " muestras son todas CERO!" << std::endl;
+        std::cout << "[ERROR CRÍTICO] El archivo puede estar corrupto o la lectura falló." << std::endl;
+    } else {
+        std::cout << "[DEBUG] Primera muestra no-cero encontrada en posición: "
+                  << (primeroNoCero - primeras.begin()) << std::endl;
     }
     
-    std::cout << "[DEBUG] Ambos chunks encontrados, leyendo datos de audio..." << std::endl;
+    std::cout << "[DEBUG] Normalizando muestras..." << std::endl;
+    archivo.avisarLecturaSecuencial();
     
-    // Verificar formato soportado
-    if (datosAudio.bitsPorMuestra != 16) {
-        throw std::runtime_error("Solo se soportan archivos WAV de 16 bits (se recibió: " + 
-                                 std::to_string(datosAudio.bitsPorMuestra) + " bits)");
+    // Decodificar, normalizar a [-1.0, 1.0] y mezclar a mono en una sola
+    // pasada con el núcleo vectorial activo
+    if (numeroCanales > 1) {
+        std::cout << "[DEBUG] Convirtiendo " << numeroCanales << " canales a mono..." << std::endl;
     }
+    datosAudio.muestras.resize(numeroTramas);
+    nucleos.convertir(tipo, datos.begin(), datosAudio.muestras.data(), numeroTramas, numeroCanales);
+    datosAudio.numeroCanales = 1;
     
-    // Regresar a la posición del chunk data
-    archivo.seekg(posicionDatos);
-    
-    // Calcular número de muestras
-    int bytesPorMuestra = datosAudio.bitsPorMuestra / 8;
-    int totalMuestras = tamanoDatos / bytesPorMuestra;
-    int numeroMuestras = totalMuestras / datosAudio.numeroCanales;
-    datosAudio.duracion = (double)numeroMuestras / datosAudio.frecuenciaMuestreo;
-    
-    std::cout << "[DEBUG] Total de muestras a leer: " << totalMuestras << std::endl;
-    std::cout << "[DEBUG] Bytes por muestra: " << bytesPorMuestra << std::endl;
-    std::cout << "[DEBUG] Tamaño del chunk data: " << tamanoDatos << " bytes" << std::endl;
+    std::cout << "[DEBUG] Lectura completada exitosamente" << std::endl;
     
-    // Leer datos de audio (usar int16_t con signo)
-    std::vector<int16_t> muestrasCrudas(totalMuestras);
-    archivo.read((char*)muestrasCrudas.data(), tamanoDatos);
+    return datosAudio;
+}
+
+DatosAudio LectorAudio::leerFLAC(const std::string& nombreArchivo, int hilos) {
+    ArchivoFLAC archivo(nombreArchivo);
+    const InfoFLAC& info = archivo.info();
     
-    // Verificar cuántos bytes se leyeron realmente
-    std::streamsize bytesLeidos = archivo.gcount();
-    std::cout << "[DEBUG] Bytes leídos: " << bytesLeidos << " de " << tamanoDatos << std::endl;
+    DatosAudio datosAudio;
+    datosAudio.frecuenciaMuestreo = info.frecuenciaMuestreo;
+    datosAudio.bitsPorMuestra = info.bitsPorMuestra;
     
-    if (bytesLeidos < tamanoDatos) {
-        std::cerr << "[ADVERTENCIA] Se leyeron " << bytesLeidos 
-                  << " bytes de " << tamanoDatos << " esperados" << std::endl;
-        muestrasCrudas.resize(bytesLeidos / bytesPorMuestra);
+    if (hilos <= 0) {
+        hilos = (int)std::max(1u, std::thread::hardware_concurrency());
     }
     
-    archivo.close();
+    std::cout << "[DEBUG] FLAC: " << info.frecuenciaMuestreo << " Hz, " << info.numeroCanales << " canales, "
+              << info.bitsPorMuestra << " bits, bloques de " << info.tamanoBloqueMinimo << "-"
+              << info.tamanoBloqueMaximo << " muestras" << std::endl;
+    std::cout << "[DEBUG] Total de muestras por canal: " << info.totalMuestras << std::endl;
+    std::cout << "[DEBUG] Decodificando tramas con " << hilos << " hilo(s)..." << std::endl;
     
-    std::cout << "[DEBUG] Datos leídos, verificando contenido..." << std::endl;
+    archivo.avisarLecturaSecuencial();
+    datosAudio.muestras.reserve((size_t)info.totalMuestras);
+    archivo.decodificar(archivo.inicioTramas(), archivo.tamano(), hilos, datosAudio.muestras);
     
-    // *** DIAGNÓSTICO CRÍTICO: Mostrar muestras crudas ***
-    std::cout << "[DEBUG] Primeras 20 muestras crudas (int16_t):" << std::endl;
-    for (int i = 0; i < std::min(20, (int)muestrasCrudas.size()); i++) {
-        std::cout << "  RAW[" << i << "] = " << std::setw(6) << muestrasCrudas[i];
-        
-        // Mostrar también en hexadecimal para debug
-        uint16_t valorHex = *((uint16_t*)&muestrasCrudas[i]);
-        std::cout << " (hex: 0x" << std::hex << std::setw(4) << std::setfill('0') 
-                  << valorHex << std::dec << std::setfill(' ') << ")" << std::endl;
+    if (info.totalMuestras > 0 && datosAudio.muestras.size() != info.totalMuestras) {
+        std::cerr << "[ADVERTENCIA] El archivo contiene " << datosAudio.muestras.size()
+                  << " muestras de " << info.totalMuestras << " esperadas" << std::endl;
     }
     
-    // Verificar si todas son ceros
-    bool todosCeros = true;
-    int primeroNoZero = -1;
-    for (size_t i = 0; i < std::min((size_t)10000, muestrasCrudas.size()); i++) {
-        if (muestrasCrudas[i] != 0) {
-            todosCeros = false;
-            primeroNoZero = i;
-            break;
-        }
-    }
+    datosAudio.numeroCanales = 1;
+    datosAudio.duracion = (double)datosAudio.muestras.size() / datosAudio.frecuenciaMuestreo;
     
-    if (todosCeros) {
-        std::cout << "[ERROR CRÍTICO] ¡Las primeras 10000 muestras son todas CERO!" << std::endl;
-        std::cout << "[ERROR CRÍTICO] El archivo puede estar corrupto o la lectura falló." << std::endl;
-    } else {
-        std::cout << "[DEBUG] Primera muestra no-cero encontrada en posición: " << primeroNoZero << std::endl;
-    }
+    std::cout << "[DEBUG] Lectura completada exitosamente" << std::endl;
     
-    std::cout << "[DEBUG] Normalizando muestras..." << std::endl;
+    return datosAudio;
+}
+
+bool LectorAudio::esFLAC(const std::string& nombreArchivo) {
+    if (nombreArchivo.size() < 5) {
+        return false;
+    }
+    std::string extension = nombreArchivo.substr(nombreArchivo.size() - 5);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return (char)std::tolower(c); });
+    return extension == ".flac";
+}
+
+DatosAudio LectorAudio::leerFuente(FuenteAudio& fuente) {
+    DatosAudio datosAudio;
+    datosAudio.frecuenciaMuestreo = fuente.frecuenciaMuestreo();
+    datosAudio.numeroCanales = 1;
+    datosAudio.bitsPorMuestra = fuente.bitsPorMuestra();
     
-    // Convertir a formato normalizado [-1.0, 1.0]
-    datosAudio.muestras.resize(muestrasCrudas.size());
-    for (size_t i = 0; i < muestrasCrudas.size(); i++) {
-        datosAudio.muestras[i] = static_cast<float>(muestrasCrudas[i]) / 32768.0f;
+    if (fuente.totalMuestras() > 0) {
+        datosAudio.muestras.reserve((size_t)fuente.totalMuestras());
     }
     
-    // Convertir a mono si es estéreo
-    if (datosAudio.numeroCanales == 2) {
-        std::cout << "[DEBUG] Convirtiendo estéreo a mono..." << std::endl;
-        datosAudio.muestras = estereoAMono(datosAudio.muestras);
-        datosAudio.numeroCanales = 1;
+    std::vector<float> bloque;
+    while (fuente.siguienteBloque(bloque)) {
+        datosAudio.muestras.insert(datosAudio.muestras.end(), bloque.begin(), bloque.end());
     }
     
-    std::cout << "[DEBUG] Lectura completada exitosamente" << std::endl;
-    
+    datosAudio.duracion = (double)datosAudio.muestras.size() / datosAudio.frecuenciaMuestreo;
     return datosAudio;
 }
 
@@ -13,11 +13,24 @@ struct DatosAudio {
     double duracion;               // Duración en segundos
 };
 
+class FuenteAudio;
+
 class LectorAudio {
 public:
-    // Leer archivo WAV y convertir a mono si es necesario
+    // Leer archivo WAV (proyectado en memoria, sin búferes intermedios) y
+    // convertir a mono si es necesario
     static DatosAudio leerWAV(const std::string& nombreArchivo);
     
+    // Leer archivo FLAC con el decodificador propio, repartiendo las tramas
+    // entre 'hilos' hilos (0: uno por núcleo), y mezclar a mono
+    static DatosAudio leerFLAC(const std::string& nombreArchivo, int hilos = 0);
+    
+    // El archivo tiene extensión .flac (sin distinguir mayúsculas)
+    static bool esFLAC(const std::string& nombreArchivo);
+    
+    // Leer todas las muestras restantes de una fuente por bloques
+    static DatosAudio leerFuente(FuenteAudio& fuente);
+    
     // Convertir estéreo a mono (promedio de canales)
     static std::vector<float> estereoAMono(const std::vector<float>& estereo);
     
@@ -0,0 +1,72 @@
+#include "NucleosAudio.h"
+#include "NucleosAudioVectorial.h"
+
+namespace {
+// "Registro" de un solo carril: la misma implementación genérica en escalar
+struct RegistroAudioEscalar {
+    using Registro = float;
+    static constexpr int ancho = 1;
+    
+    static void guardar(float* p, Registro v) { *p = v; }
+    static Registro difundir(float x) { return x; }
+    static Registro sumar(Registro a, Registro b) { return a + b; }
+    static Registro multiplicar(Registro a, Registro b) { return a * b; }
+    static Registro sumarPares(Registro a, Registro b) { return a + b; }
+    
+    template <TipoMuestra Tipo>
+    static Registro cargarNormalizadas(const unsigned char* p) {
+        return leerNormalizada<RegistroAudioEscalar, Tipo>(p);
+    }
+};
+}
+
+int NucleosAudio::bytesPorMuestra(TipoMuestra tipo) {
+    switch (tipo) {
+        case TipoMuestra::Entero8:    return 1;
+        case TipoMuestra::Entero16:   return 2;
+        case TipoMuestra::Entero24:   return 3;
+        case TipoMuestra::Entero32:   return 4;
+        case TipoMuestra::Flotante32: return 4;
+        case TipoMuestra::Flotante64: return 8;
+    }
+    return 0;
+}
+
+const NucleosAudio::Tabla* NucleosAudio::tablaEscalar() {
+    static const Tabla tabla = {
+        Conjunto::Escalar, "Escalar",
+        conversionesVectoriales<RegistroAudioEscalar>()
+    };
+    return &tabla;
+}
+
+const NucleosAudio::Tabla* NucleosAudio::obtener(Conjunto conjunto) {
+    // Misma detección por CPUID que los núcleos de la FFT
+    if (!NucleosFFT::cpuSoporta(conjunto)) {
+        return nullptr;
+    }
+    
+    switch (conjunto) {
+        case Conjunto::Escalar: return tablaEscalar();
+        case Conjunto::SSE2:    return tablaSSE2();
+        case Conjunto::AVX2:    return tablaAVX2();
+        case Conjunto::AVX512:  return tablaAVX512();
+    }
+    return nullptr;
+}
+
+const NucleosAudio::Tabla& NucleosAudio::activos() {
+    // Detección única: el mejor conjunto disponible en esta CPU
+    static const Tabla* mejor = [] {
+        const Conjunto preferencia[] = {
+            Conjunto::AVX512, Conjunto::AVX2, Conjunto::SSE2, Conjunto::Escalar
+        };
+        for (Conjunto c : preferencia) {
+            if (const Tabla* tabla = obtener(c)) {
+                return tabla;
+            }
+        }
+        return tablaEscalar();
+    }();
+    return *mejor;
+}
@@ -0,0 +1,62 @@
+#ifndef NUCLEOS_AUDIO_H
+#define NUCLEOS_AUDIO_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "../fft/NucleosFFT.h"
+
+// Núcleos de conversión de PCM entrelazado a muestras mono float normalizadas
+// a [-1.0, 1.0]: decodificación, normalización y mezcla de canales en una sola
+// pasada, sin búferes intermedios. Igual que NucleosFFT, hay una variante
+// escalar y variantes SSE2/AVX2/AVX-512 en unidades de traducción propias, y
+// la mejor soportada por la CPU se elige en tiempo de ejecución.
+class NucleosAudio {
+public:
+    using Conjunto = NucleosFFT::Conjunto;
+
+    // Codificaciones de muestra soportadas (little-endian, como en WAV)
+    enum class TipoMuestra {
+        Entero8,        // Sin signo, 128 = silencio
+        Entero16,
+        Entero24,       // Empaquetado en 3 bytes
+        Entero32,
+        Flotante32,     // IEEE 754
+        Flotante64
+    };
+    static constexpr int numTiposMuestra = 6;
+
+    // Bytes que ocupa una muestra de cada tipo
+    static int bytesPorMuestra(TipoMuestra tipo);
+
+    // Convertir 'tramas' tramas de 'canales' muestras entrelazadas en 'tramas'
+    // muestras mono: cada muestra se normaliza y los canales se promedian
+    using FuncionConversion = void (*)(const unsigned char* entrada, float* salida,
+                                       size_t tramas, int canales);
+
+    struct Tabla {
+        Conjunto conjunto;
+        const char* nombre;
+        std::array<FuncionConversion, numTiposMuestra> conversiones;   // Indexado por TipoMuestra
+
+        void convertir(TipoMuestra tipo, const void* entrada, float* salida,
+                       size_t tramas, int canales) const {
+            conversiones[(int)tipo]((const unsigned char*)entrada, salida, tramas, canales);
+        }
+    };
+
+    // Mejor conjunto soportado por la CPU (se detecta una sola vez)
+    static const Tabla& activos();
+
+    // Núcleos de un conjunto concreto (nullptr si no está compilado o la CPU no lo soporta)
+    static const Tabla* obtener(Conjunto conjunto);
+
+private:
+    // Tablas definidas en cada unidad de traducción (nullptr si no se compiló)
+    static const Tabla* tablaEscalar();
+    static const Tabla* tablaSSE2();
+    static const Tabla* tablaAVX2();
+    static const Tabla* tablaAVX512();
+};
+
+#endif
@@ -0,0 +1,79 @@
+// Núcleos de conversión PCM AVX2 (8 muestras por registro). Este archivo se
+// compila con -mavx2 (/arch:AVX2 en MSVC) y sólo se usa si CPUID confirma soporte.
+#include "NucleosAudio.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#include "NucleosAudioVectorial.h"
+
+namespace {
+// 8 muestras de 24 bits (24 bytes) en la parte alta de 8 enteros de 32 bits.
+// Cada mitad de 128 bits se carga por separado para no leer más allá de los
+// 24 bytes: la baja desde p (muestras 0-3) y la alta desde p + 8 (muestras 4-7).
+__m256i cargar24AVX2(const unsigned char* p) {
+    __m256i x = _mm256_set_m128i(_mm_loadu_si128((const __m128i*)(p + 8)),
+                                 _mm_loadu_si128((const __m128i*)p));
+    const __m256i orden = _mm256_setr_epi8(
+        -1, 0, 1, 2,   -1, 3, 4, 5,    -1, 6, 7, 8,     -1, 9, 10, 11,
+        -1, 4, 5, 6,   -1, 7, 8, 9,    -1, 10, 11, 12,  -1, 13, 14, 15);
+    return _mm256_srai_epi32(_mm256_shuffle_epi8(x, orden), 8);
+}
+
+struct RegistroAudioAVX2 {
+    using Registro = __m256;
+    static constexpr int ancho = 8;
+    
+    static void guardar(float* p, Registro v) { _mm256_storeu_ps(p, v); }
+    static Registro difundir(float x) { return _mm256_set1_ps(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm256_add_ps(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm256_mul_ps(a, b); }
+    
+    // Los barajados de AVX trabajan por mitades de 128 bits: sumar los pares y
+    // reordenar después las palabras de 64 bits (a01 a23 a45 a67 b01 b23 b45 b67)
+    static Registro sumarPares(Registro a, Registro b) {
+        __m256 suma = _mm256_add_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                                    _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(suma), _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+    
+    template <TipoMuestra Tipo>
+    static Registro cargarNormalizadas(const unsigned char* p) {
+        const __m256 escala = _mm256_set1_ps(escalaMuestra<Tipo>());
+        if constexpr (Tipo == TipoMuestra::Entero8) {
+            __m256i x = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)p));
+            x = _mm256_sub_epi32(x, _mm256_set1_epi32(128));
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero16) {
+            __m256i x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)p));
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero24) {
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(cargar24AVX2(p)), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero32) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)p);
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Flotante32) {
+            return _mm256_loadu_ps((const float*)p);
+        } else {
+            __m128 bajo = _mm256_cvtpd_ps(_mm256_loadu_pd((const double*)p));
+            __m128 alto = _mm256_cvtpd_ps(_mm256_loadu_pd((const double*)p + 4));
+            return _mm256_set_m128(alto, bajo);
+        }
+    }
+};
+}
+
+const NucleosAudio::Tabla* NucleosAudio::tablaAVX2() {
+    static const Tabla tabla = {
+        Conjunto::AVX2, "AVX2",
+        conversionesVectoriales<RegistroAudioAVX2>()
+    };
+    return &tabla;
+}
+
+#else
+
+const NucleosAudio::Tabla* NucleosAudio::tablaAVX2() {
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,78 @@
+// Núcleos de conversión PCM AVX-512 (16 muestras por registro). Este archivo se
+// compila con -mavx512f (/arch:AVX512 en MSVC) y sólo se usa si CPUID confirma soporte.
+#include "NucleosAudio.h"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#include "NucleosAudioVectorial.h"
+
+namespace {
+// 8 muestras de 24 bits en 8 enteros de 32 bits (AVX-512F no baraja bytes en
+// registros de 512 bits, así que se usan dos mitades de 256)
+__m256i cargar24Mitad(const unsigned char* p) {
+    __m256i x = _mm256_set_m128i(_mm_loadu_si128((const __m128i*)(p + 8)),
+                                 _mm_loadu_si128((const __m128i*)p));
+    const __m256i orden = _mm256_setr_epi8(
+        -1, 0, 1, 2,   -1, 3, 4, 5,    -1, 6, 7, 8,     -1, 9, 10, 11,
+        -1, 4, 5, 6,   -1, 7, 8, 9,    -1, 10, 11, 12,  -1, 13, 14, 15);
+    return _mm256_srai_epi32(_mm256_shuffle_epi8(x, orden), 8);
+}
+
+struct RegistroAudioAVX512 {
+    using Registro = __m512;
+    static constexpr int ancho = 16;
+    
+    static void guardar(float* p, Registro v) { _mm512_storeu_ps(p, v); }
+    static Registro difundir(float x) { return _mm512_set1_ps(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm512_add_ps(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm512_mul_ps(a, b); }
+    
+    static Registro sumarPares(Registro a, Registro b) {
+        const __m512i pares = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+        const __m512i impares = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+        return _mm512_add_ps(_mm512_permutex2var_ps(a, pares, b), _mm512_permutex2var_ps(a, impares, b));
+    }
+    
+    template <TipoMuestra Tipo>
+    static Registro cargarNormalizadas(const unsigned char* p) {
+        const __m512 escala = _mm512_set1_ps(escalaMuestra<Tipo>());
+        if constexpr (Tipo == TipoMuestra::Entero8) {
+            __m512i x = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)p));
+            x = _mm512_sub_epi32(x, _mm512_set1_epi32(128));
+            return _mm512_mul_ps(_mm512_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero16) {
+            __m512i x = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)p));
+            return _mm512_mul_ps(_mm512_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero24) {
+            __m512i x = _mm512_inserti64x4(_mm512_castsi256_si512(cargar24Mitad(p)), cargar24Mitad(p + 24), 1);
+            return _mm512_mul_ps(_mm512_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero32) {
+            __m512i x = _mm512_loadu_si512((const void*)p);
+            return _mm512_mul_ps(_mm512_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Flotante32) {
+            return _mm512_loadu_ps((const float*)p);
+        } else {
+            __m256 bajo = _mm512_cvtpd_ps(_mm512_loadu_pd((const double*)p));
+            __m256 alto = _mm512_cvtpd_ps(_mm512_loadu_pd((const double*)p + 8));
+            return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(bajo)),
+                                                       _mm256_castps_pd(alto), 1));
+        }
+    }
+};
+}
+
+const NucleosAudio::Tabla* NucleosAudio::tablaAVX512() {
+    static const Tabla tabla = {
+        Conjunto::AVX512, "AVX-512",
+        conversionesVectoriales<RegistroAudioAVX512>()
+    };
+    return &tabla;
+}
+
+#else
+
+const NucleosAudio::Tabla* NucleosAudio::tablaAVX512() {
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,75 @@
+// Núcleos de conversión PCM SSE2 (4 muestras por registro)
+#include "NucleosAudio.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#include "NucleosAudioVectorial.h"
+
+namespace {
+struct RegistroAudioSSE2 {
+    using Registro = __m128;
+    static constexpr int ancho = 4;
+    
+    static void guardar(float* p, Registro v) { _mm_storeu_ps(p, v); }
+    static Registro difundir(float x) { return _mm_set1_ps(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm_add_ps(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm_mul_ps(a, b); }
+    
+    // (a0 + a1, a2 + a3, b0 + b1, b2 + b3)
+    static Registro sumarPares(Registro a, Registro b) {
+        return _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                          _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    
+    template <TipoMuestra Tipo>
+    static Registro cargarNormalizadas(const unsigned char* p) {
+        const __m128 escala = _mm_set1_ps(escalaMuestra<Tipo>());
+        if constexpr (Tipo == TipoMuestra::Entero8) {
+            // Sin signo: ampliar con ceros a 32 bits y restar el silencio (128)
+            int32_t bytes;
+            std::memcpy(&bytes, p, 4);
+            __m128i x = _mm_cvtsi32_si128(bytes);
+            x = _mm_unpacklo_epi16(_mm_unpacklo_epi8(x, _mm_setzero_si128()), _mm_setzero_si128());
+            x = _mm_sub_epi32(x, _mm_set1_epi32(128));
+            return _mm_mul_ps(_mm_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero16) {
+            // Extender el signo de 16 a 32 bits: duplicar cada muestra y desplazar
+            __m128i x = _mm_loadl_epi64((const __m128i*)p);
+            x = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+            return _mm_mul_ps(_mm_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero24) {
+            // SSE2 no tiene barajado de bytes: montar los 4 enteros por separado
+            auto leer24 = [](const unsigned char* q) {
+                return (int32_t)(((uint32_t)q[0] << 8) | ((uint32_t)q[1] << 16) | ((uint32_t)q[2] << 24));
+            };
+            __m128i x = _mm_setr_epi32(leer24(p), leer24(p + 3), leer24(p + 6), leer24(p + 9));
+            return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(x, 8)), escala);
+        } else if constexpr (Tipo == TipoMuestra::Entero32) {
+            __m128i x = _mm_loadu_si128((const __m128i*)p);
+            return _mm_mul_ps(_mm_cvtepi32_ps(x), escala);
+        } else if constexpr (Tipo == TipoMuestra::Flotante32) {
+            return _mm_loadu_ps((const float*)p);
+        } else {
+            __m128 bajo = _mm_cvtpd_ps(_mm_loadu_pd((const double*)p));
+            __m128 alto = _mm_cvtpd_ps(_mm_loadu_pd((const double*)p + 2));
+            return _mm_movelh_ps(bajo, alto);
+        }
+    }
+};
+}
+
+const NucleosAudio::Tabla* NucleosAudio::tablaSSE2() {
+    static const Tabla tabla = {
+        Conjunto::SSE2, "SSE2",
+        conversionesVectoriales<RegistroAudioSSE2>()
+    };
+    return &tabla;
+}
+
+#else
+
+const NucleosAudio::Tabla* NucleosAudio::tablaSSE2() {
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef NUCLEOS_AUDIO_VECTORIAL_H
+#define NUCLEOS_AUDIO_VECTORIAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "NucleosAudio.h"
+
+// Implementación genérica de la conversión PCM → mono, parametrizada por un
+// tipo de registro V que expone: Registro, ancho, guardar, sumar, multiplicar,
+// difundir, cargarNormalizadas<Tipo>(p) (ancho muestras consecutivas de p ya
+// normalizadas) y sumarPares(a, b) (sumas de pares consecutivos de la
+// concatenación a·b, en orden). Cada unidad de traducción la instancia con sus
+// propios tipos V (en un espacio de nombres anónimo), igual que
+// NucleosFFTVectorial.h, y todo lo que se compila aquí depende de V para que
+// el código de cada conjunto de instrucciones no se mezcle.
+//
+// Todas las variantes calculan exactamente lo mismo que la escalar: la
+// normalización es una conversión y un producto por una potencia de 2, y los
+// canales se suman en orden y se dividen por su número (el producto por 0.5
+// de la variante estéreo es exacto).
+
+using TipoMuestra = NucleosAudio::TipoMuestra;
+
+// Factor de normalización de cada tipo entero: 1 / 2^(bits - 1)
+template <TipoMuestra Tipo>
+constexpr float escalaMuestra() {
+    return Tipo == TipoMuestra::Entero8  ? 1.0f / 128.0f :
+           Tipo == TipoMuestra::Entero16 ? 1.0f / 32768.0f :
+           Tipo == TipoMuestra::Entero24 ? 1.0f / 8388608.0f :
+           Tipo == TipoMuestra::Entero32 ? 1.0f / 2147483648.0f : 1.0f;
+}
+
+template <TipoMuestra Tipo>
+constexpr int bytesMuestra() {
+    return Tipo == TipoMuestra::Entero8  ? 1 :
+           Tipo == TipoMuestra::Entero16 ? 2 :
+           Tipo == TipoMuestra::Entero24 ? 3 :
+           Tipo == TipoMuestra::Flotante64 ? 8 : 4;
+}
+
+// Leer y normalizar una muestra (camino escalar y restos)
+template <class V, TipoMuestra Tipo>
+float leerNormalizada(const unsigned char* p) {
+    if constexpr (Tipo == TipoMuestra::Entero8) {
+        return (float)((int)p[0] - 128) * escalaMuestra<Tipo>();
+    } else if constexpr (Tipo == TipoMuestra::Entero16) {
+        int16_t x;
+        std::memcpy(&x, p, 2);
+        return (float)x * escalaMuestra<Tipo>();
+    } else if constexpr (Tipo == TipoMuestra::Entero24) {
+        // Los 3 bytes en la parte alta de un entero de 32 bits y desplazamiento
+        // aritmético para extender el signo
+        int32_t x = (int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24)) >> 8;
+        return (float)x * escalaMuestra<Tipo>();
+    } else if constexpr (Tipo == TipoMuestra::Entero32) {
+        int32_t x;
+        std::memcpy(&x, p, 4);
+        return (float)x * escalaMuestra<Tipo>();
+    } else if constexpr (Tipo == TipoMuestra::Flotante32) {
+        float x;
+        std::memcpy(&x, p, 4);
+        return x;
+    } else {
+        double x;
+        std::memcpy(&x, p, 8);
+        return (float)x;
+    }
+}
+
+// Promedio de los canales de una trama
+template <class V, TipoMuestra Tipo>
+float mezclarTrama(const unsigned char* trama, int canales) {
+    constexpr int bytes = bytesMuestra<Tipo>();
+    float suma = leerNormalizada<V, Tipo>(trama);
+    for (int c = 1; c < canales; c++) {
+        suma += leerNormalizada<V, Tipo>(trama + c * bytes);
+    }
+    if (canales == 1) {
+        return suma;
+    }
+    return canales == 2 ? suma * 0.5f : suma / (float)canales;
+}
+
+template <class V, TipoMuestra Tipo>
+void convertirVectorial(const unsigned char* entrada, float* salida, size_t tramas, int canales) {
+    constexpr int bytes = bytesMuestra<Tipo>();
+    size_t i = 0;
+
+    if (canales == 1) {
+        for (; i + V::ancho <= tramas; i += V::ancho) {
+            V::guardar(salida + i, V::template cargarNormalizadas<Tipo>(entrada + i * bytes));
+        }
+    } else if (canales == 2) {
+        const typename V::Registro mitad = V::difundir(0.5f);
+        for (; i + V::ancho <= tramas; i += V::ancho) {
+            const unsigned char* p = entrada + 2 * i * bytes;
+            typename V::Registro a = V::template cargarNormalizadas<Tipo>(p);
+            typename V::Registro b = V::template cargarNormalizadas<Tipo>(p + V::ancho * bytes);
+            V::guardar(salida + i, V::multiplicar(V::sumarPares(a, b), mitad));
+        }
+    } else {
+        // Más de dos canales: normalizar un bloque de tramas con carga
+        // contigua y sumar los canales de cada trama en orden
+        constexpr size_t capacidad = 1024;
+        float normalizadas[capacidad];
+        size_t tramasBloque = capacidad / canales;
+        while (tramasBloque > 0 && i + tramasBloque <= tramas) {
+            size_t total = tramasBloque * canales;
+            const unsigned char* p = entrada + i * canales * bytes;
+            size_t k = 0;
+            for (; k + V::ancho <= total; k += V::ancho) {
+                V::guardar(normalizadas + k, V::template cargarNormalizadas<Tipo>(p + k * bytes));
+            }
+            for (; k < total; k++) {
+                normalizadas[k] = leerNormalizada<V, Tipo>(p + k * bytes);
+            }
+            for (size_t t = 0; t < tramasBloque; t++) {
+                const float* trama = normalizadas + t * canales;
+                float suma = trama[0];
+                for (int c = 1; c < canales; c++) {
+                    suma += trama[c];
+                }
+                salida[i + t] = suma / (float)canales;
+            }
+            i += tramasBloque;
+        }
+    }
+
+    // Tramas sobrantes
+    for (; i < tramas; i++) {
+        salida[i] = mezclarTrama<V, Tipo>(entrada + i * canales * bytes, canales);
+    }
+}
+
+// Conversiones de un tipo de registro para todos los tipos de muestra, en el
+// orden de NucleosAudio::TipoMuestra
+template <class V>
+constexpr std::array<NucleosAudio::FuncionConversion, NucleosAudio::numTiposMuestra>
+conversionesVectoriales() {
+    return {{
+        &convertirVectorial<V, TipoMuestra::Entero8>,
+        &convertirVectorial<V, TipoMuestra::Entero16>,
+        &convertirVectorial<V, TipoMuestra::Entero24>,
+        &convertirVectorial<V, TipoMuestra::Entero32>,
+        &convertirVectorial<V, TipoMuestra::Flotante32>,
+        &convertirVectorial<V, TipoMuestra::Flotante64>
+    }};
+}
+
+#endif
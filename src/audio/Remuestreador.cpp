@@ -0,0 +1,230 @@
+#include "Remuestreador.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+// Los coeficientes de cada fase se redondean a un múltiplo de este número para
+// que el producto escalar use acumuladores independientes sin resto
+constexpr int acumuladores = 8;
+
+// Función de Bessel modificada de primera especie y orden 0 (serie de potencias)
+double besselI0(double x) {
+    double suma = 1.0;
+    double termino = 1.0;
+    double cuarto = 0.25 * x * x;
+    for (int k = 1; k < 64; k++) {
+        termino *= cuarto / ((double)k * k);
+        suma += termino;
+        if (termino < 1e-12 * suma) {
+            break;
+        }
+    }
+    return suma;
+}
+
+// Parámetro beta de la ventana de Kaiser para una atenuación dada (dB)
+double betaKaiser(double atenuacion) {
+    if (atenuacion > 50.0) {
+        return 0.1102 * (atenuacion - 8.7);
+    }
+    if (atenuacion >= 21.0) {
+        return 0.5842 * std::pow(atenuacion - 21.0, 0.4) + 0.07886 * (atenuacion - 21.0);
+    }
+    return 0.0;
+}
+
+}
+
+Remuestreador::Remuestreador(int frecuenciaOrigen, const Configuracion& config)
+    : frecuenciaOrigen_(frecuenciaOrigen),
+      frecuenciaDestino_(config.frecuenciaDestino) {
+    if (frecuenciaOrigen <= 0 || config.frecuenciaDestino <= 0) {
+        throw std::invalid_argument("Las frecuencias de muestreo del remuestreador deben ser positivas");
+    }
+    if (config.bandaPaso <= 0.0 || config.bandaPaso >= 1.0) {
+        throw std::invalid_argument("La banda de paso del remuestreador debe estar entre 0 y 1");
+    }
+
+    int divisor = std::gcd(frecuenciaOrigen, config.frecuenciaDestino);
+    interpolacion_ = config.frecuenciaDestino / divisor;
+    decimacion_ = frecuenciaOrigen / divisor;
+
+    if (esIdentidad()) {
+        coeficientesPorFase_ = 1;
+        fases_ = {1.0f};
+    } else {
+        // Longitud necesaria (en muestras de entrada) para la transición entre
+        // bandaPaso · Nyquist y el Nyquist de la frecuencia menor (fórmula de Kaiser)
+        double nyquist = 0.5 * std::min(frecuenciaOrigen, config.frecuenciaDestino);
+        double transicion = (1.0 - config.bandaPaso) * nyquist / frecuenciaOrigen;
+        int coeficientes = (int)std::ceil((config.atenuacion - 7.95) / (2.285 * 2.0 * M_PI * transicion)) + 1;
+        coeficientesPorFase_ = (coeficientes + acumuladores - 1) / acumuladores * acumuladores;
+
+        std::vector<double> prototipo = disenarPrototipo(interpolacion_, decimacion_, coeficientesPorFase_,
+                                                         config.bandaPaso, config.atenuacion);
+
+        // Descomposición polifásica con los coeficientes de cada fase invertidos
+        const int K = coeficientesPorFase_;
+        fases_.resize((size_t)interpolacion_ * K);
+        for (int p = 0; p < interpolacion_; p++) {
+            for (int j = 0; j < K; j++) {
+                fases_[(size_t)p * K + j] = (float)prototipo[p + (size_t)(K - 1 - j) * interpolacion_];
+            }
+        }
+    }
+
+    // Historia inicial en cero; la primera salida corresponde al centro del
+    // filtro (retardo de grupo compensado)
+    bufer_.assign(coeficientesPorFase_, 0.0f);
+    inicioBufer_ = -(long long)coeficientesPorFase_;
+    posicion_ = ((long long)interpolacion_ * coeficientesPorFase_ - 1) / 2;
+    if (esIdentidad()) {
+        posicion_ = 0;
+    }
+}
+
+std::vector<double> Remuestreador::disenarPrototipo(
+    int interpolacion,
+    int decimacion,
+    int coeficientesPorFase,
+    double bandaPaso,
+    double atenuacion
+) {
+    const size_t longitud = (size_t)interpolacion * coeficientesPorFase;
+
+    // Corte en el centro de la transición, normalizado a la frecuencia
+    // intermedia L·fs: la banda eliminada empieza justo en el Nyquist menor
+    double corte = 0.5 * (1.0 + bandaPaso) * 0.5 / std::max(interpolacion, decimacion);
+
+    // Centro en una muestra entera para que el retardo se compense exactamente
+    // (con longitud par sobra el último coeficiente, que queda en cero)
+    double centro = (double)((longitud - 1) / 2);
+    double beta = betaKaiser(atenuacion);
+    double normalizacionVentana = besselI0(beta);
+
+    std::vector<double> coeficientes(longitud);
+    double suma = 0.0;
+    for (size_t n = 0; n < longitud; n++) {
+        double m = (double)n - centro;
+        double ideal = m == 0.0 ? 2.0 * corte : std::sin(2.0 * M_PI * corte * m) / (M_PI * m);
+
+        double r = centro > 0.0 ? m / centro : 0.0;
+        if (std::abs(r) > 1.0) {
+            coeficientes[n] = 0.0;
+            continue;
+        }
+        double ventana = besselI0(beta * std::sqrt(1.0 - r * r)) / normalizacionVentana;
+
+        coeficientes[n] = ideal * ventana;
+        suma += coeficientes[n];
+    }
+
+    // Ganancia L en continua: compensa los L - 1 ceros de la interpolación
+    for (double& c : coeficientes) {
+        c *= interpolacion / suma;
+    }
+
+    return coeficientes;
+}
+
+size_t Remuestreador::muestrasSalida(size_t muestrasEntrada) const {
+    // ceil(entradas · L / M)
+    unsigned long long producto = (unsigned long long)muestrasEntrada * interpolacion_;
+    return (size_t)((producto + decimacion_ - 1) / decimacion_);
+}
+
+size_t Remuestreador::generar(std::vector<float>& salida, size_t limite) {
+    const int K = coeficientesPorFase_;
+    const long long finBufer = inicioBufer_ + (long long)bufer_.size();
+    size_t generadas = 0;
+
+    while (salidasProducidas_ < limite) {
+        long long indice = posicion_ / interpolacion_;
+        if (indice >= finBufer) {
+            break;
+        }
+        int fase = (int)(posicion_ % interpolacion_);
+
+        const float* coeficientes = fases_.data() + (size_t)fase * K;
+        const float* x = bufer_.data() + (indice - K + 1 - inicioBufer_);
+
+        // Producto escalar con acumuladores independientes (el compilador los
+        // agrupa en un registro vectorial)
+        float parcial[acumuladores] = {};
+        for (int j = 0; j < K; j += acumuladores) {
+            for (int a = 0; a < acumuladores; a++) {
+                parcial[a] += coeficientes[j + a] * x[j + a];
+            }
+        }
+        salida.push_back(((parcial[0] + parcial[1]) + (parcial[2] + parcial[3]))
+                       + ((parcial[4] + parcial[5]) + (parcial[6] + parcial[7])));
+
+        posicion_ += decimacion_;
+        salidasProducidas_++;
+        generadas++;
+    }
+
+    // Descartar la entrada que ya no necesita ninguna salida (en bloque, para
+    // no desplazar el búfer en cada llamada)
+    long long necesaria = posicion_ / interpolacion_ - K + 1;
+    size_t descartables = (size_t)std::max(0LL, std::min(necesaria, finBufer) - inicioBufer_);
+    if (descartables > 0 && descartables >= bufer_.size() / 2) {
+        bufer_.erase(bufer_.begin(), bufer_.begin() + descartables);
+        inicioBufer_ += (long long)descartables;
+    }
+
+    return generadas;
+}
+
+size_t Remuestreador::procesar(const float* entrada, size_t cantidad, std::vector<float>& salida) {
+    entradasRecibidas_ += cantidad;
+    if (esIdentidad()) {
+        salida.insert(salida.end(), entrada, entrada + cantidad);
+        salidasProducidas_ += cantidad;
+        return cantidad;
+    }
+
+    bufer_.insert(bufer_.end(), entrada, entrada + cantidad);
+    return generar(salida, muestrasSalida(entradasRecibidas_));
+}
+
+size_t Remuestreador::finalizar(std::vector<float>& salida) {
+    if (esIdentidad()) {
+        return 0;
+    }
+
+    // Ceros tras la última muestra para vaciar la mitad posterior del filtro
+    bufer_.insert(bufer_.end(), (size_t)coeficientesPorFase_ + 1, 0.0f);
+    return generar(salida, muestrasSalida(entradasRecibidas_));
+}
+
+DatosAudio Remuestreador::remuestrear(const DatosAudio& audio, const Configuracion& config) {
+    if (audio.numeroCanales != 1) {
+        throw std::invalid_argument("El remuestreador espera audio mono (leerWAV ya lo convierte)");
+    }
+
+    Remuestreador remuestreador(audio.frecuenciaMuestreo, config);
+    std::cout << "Remuestreando " << audio.frecuenciaMuestreo << " Hz -> " << config.frecuenciaDestino
+              << " Hz (L/M = " << remuestreador.interpolacion() << "/" << remuestreador.decimacion()
+              << ", " << remuestreador.coeficientesPorFase() << " coeficientes por fase)" << std::endl;
+
+    DatosAudio resultado;
+    resultado.frecuenciaMuestreo = config.frecuenciaDestino;
+    resultado.numeroCanales = 1;
+    resultado.bitsPorMuestra = audio.bitsPorMuestra;
+    resultado.muestras.reserve(remuestreador.muestrasSalida(audio.muestras.size()));
+
+    remuestreador.procesar(audio.muestras.data(), audio.muestras.size(), resultado.muestras);
+    remuestreador.finalizar(resultado.muestras);
+
+    resultado.duracion = (double)resultado.muestras.size() / resultado.frecuenciaMuestreo;
+    return resultado;
+}
@@ -0,0 +1,80 @@
+#ifndef REMUESTREADOR_H
+#define REMUESTREADOR_H
+
+#include <cstddef>
+#include <vector>
+#include "LectorAudio.h"
+
+// Conversión de frecuencia de muestreo por un factor racional L/M con un
+// filtro polifásico: el pasa bajos antialias (sinc enventanado con Kaiser) se
+// diseña a la frecuencia intermedia L·fs y se descompone en L fases, de modo
+// que cada muestra de salida cuesta un producto escalar de coeficientesPorFase()
+// muestras de entrada, sin calcular nunca la señal sobremuestreada.
+//
+// Se usa para llevar todo el audio a una frecuencia de análisis común
+// (11025 Hz por defecto) antes del espectrograma: los hashes sólo usan hasta
+// 5000 Hz, así que la FFT de cada ventana cubre más tiempo con el mismo
+// tamaño y los fingerprints no dependen de la frecuencia del archivo.
+//
+// El estado se conserva entre llamadas a procesar(), así que la señal puede
+// llegar por bloques de cualquier tamaño (ver FuenteRemuestreada).
+class Remuestreador {
+public:
+    struct Configuracion {
+        int frecuenciaDestino = 11025;   // Hz
+        double bandaPaso = 0.9;          // Fracción del Nyquist menor que se conserva intacta
+        double atenuacion = 80.0;        // Atenuación mínima de la banda eliminada (dB)
+    };
+
+    Remuestreador(int frecuenciaOrigen, const Configuracion& config);
+
+    // Remuestrear 'cantidad' muestras y añadir a 'salida' las que ya se pueden
+    // calcular. Devuelve cuántas se añadieron.
+    size_t procesar(const float* entrada, size_t cantidad, std::vector<float>& salida);
+
+    // Completar la salida al terminar la entrada (la cola del filtro). En total
+    // se producen ceil(entradas · L / M) muestras, alineadas con la entrada.
+    size_t finalizar(std::vector<float>& salida);
+
+    int frecuenciaOrigen() const { return frecuenciaOrigen_; }
+    int frecuenciaDestino() const { return frecuenciaDestino_; }
+    int interpolacion() const { return interpolacion_; }   // L
+    int decimacion() const { return decimacion_; }         // M
+    int coeficientesPorFase() const { return coeficientesPorFase_; }
+    bool esIdentidad() const { return interpolacion_ == decimacion_; }
+
+    // Número de muestras de salida para 'muestrasEntrada' muestras de entrada
+    size_t muestrasSalida(size_t muestrasEntrada) const;
+
+    // Remuestrear una señal mono completa
+    static DatosAudio remuestrear(const DatosAudio& audio, const Configuracion& config);
+
+    // Prototipo pasa bajos (longitud L · coeficientesPorFase, ganancia L en continua)
+    static std::vector<double> disenarPrototipo(int interpolacion, int decimacion,
+                                                int coeficientesPorFase, double bandaPaso,
+                                                double atenuacion);
+
+private:
+    // Calcular las salidas cuyas muestras de entrada ya están en el búfer
+    size_t generar(std::vector<float>& salida, size_t limite);
+
+    int frecuenciaOrigen_;
+    int frecuenciaDestino_;
+    int interpolacion_;
+    int decimacion_;
+    int coeficientesPorFase_;
+
+    // fases_[p · K + j]: coeficientes de la fase p en orden inverso, para que
+    // cada salida sea un producto escalar con muestras consecutivas
+    std::vector<float> fases_;
+
+    // Entrada pendiente; bufer_[0] es la muestra de índice absoluto inicioBufer_
+    std::vector<float> bufer_;
+    long long inicioBufer_;
+
+    long long posicion_;            // Instante de la siguiente salida en la malla L·fs
+    size_t salidasProducidas_ = 0;
+    size_t entradasRecibidas_ = 0;
+};
+
+#endif
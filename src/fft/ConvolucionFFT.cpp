@@ -0,0 +1,106 @@
+#include "ConvolucionFFT.h"
+#include "FFT.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+int tamanoFFTValido(int numCoeficientes, int tamanoFFT) {
+    if (numCoeficientes < 1) {
+        throw std::invalid_argument("El filtro debe tener al menos un coeficiente");
+    }
+    if (tamanoFFT == 0) {
+        return FFT::siguientePotenciaDeDos(4 * numCoeficientes);
+    }
+    if (tamanoFFT < 2 * numCoeficientes) {
+        throw std::invalid_argument("El tamaño de la FFT debe ser al menos el doble del número de coeficientes");
+    }
+    return tamanoFFT;
+}
+}
+
+template <typename T>
+ConvolucionFFT<T>::ConvolucionFFT(const std::vector<T>& coeficientes, Metodo metodo, int tamanoFFT)
+    : numCoeficientes_(coeficientes.size()),
+      metodo_(metodo),
+      plan_(tamanoFFTValido(coeficientes.size(), tamanoFFT)) {
+    const int N = plan_.tamano();
+    tamanoBloque_ = N - numCoeficientes_ + 1;
+    
+    // Espectro del filtro completado con ceros
+    bufer_.assign(N, T(0));
+    std::copy(coeficientes.begin(), coeficientes.end(), bufer_.begin());
+    espectroFiltro_.resize(plan_.numBins());
+    plan_.ejecutar(bufer_.data(), espectroFiltro_.data());
+    
+    espectro_.resize(plan_.numBins());
+    estado_.assign(numCoeficientes_ - 1, T(0));
+}
+
+template <typename T>
+void ConvolucionFFT<T>::procesarBloque(const T* entrada, T* salida) {
+    const int N = plan_.tamano();
+    const int L = numCoeficientes_;
+    const int B = tamanoBloque_;
+    
+    if (metodo_ == Metodo::SolapamientoSuma) {
+        // Bloque completado con ceros: la convolución lineal de B + L - 1 muestras cabe en N
+        std::copy(entrada, entrada + B, bufer_.begin());
+        std::fill(bufer_.begin() + B, bufer_.end(), T(0));
+    } else {
+        // Las L - 1 muestras anteriores delante del bloque; las primeras L - 1
+        // salidas quedan contaminadas por la convolución circular y se descartan
+        std::copy(estado_.begin(), estado_.end(), bufer_.begin());
+        std::copy(entrada, entrada + B, bufer_.begin() + (L - 1));
+        std::copy(bufer_.begin() + B, bufer_.end(), estado_.begin());
+    }
+    
+    plan_.ejecutar(bufer_.data(), espectro_.data());
+    for (size_t k = 0; k < espectro_.size(); k++) {
+        espectro_[k] = espectro_[k] * espectroFiltro_[k];
+    }
+    plan_.ejecutarInversa(espectro_.data(), bufer_.data());
+    
+    if (metodo_ == Metodo::SolapamientoSuma) {
+        // Sumar la cola del bloque anterior y guardar la de éste (B >= L - 1)
+        for (int i = 0; i < L - 1; i++) {
+            salida[i] = bufer_[i] + estado_[i];
+        }
+        std::copy(bufer_.begin() + (L - 1), bufer_.begin() + B, salida + (L - 1));
+        std::copy(bufer_.begin() + B, bufer_.begin() + N, estado_.begin());
+    } else {
+        std::copy(bufer_.begin() + (L - 1), bufer_.end(), salida);
+    }
+}
+
+template <typename T>
+std::vector<T> ConvolucionFFT<T>::aplicar(const std::vector<T>& senal) {
+    reiniciar();
+    
+    std::vector<T> salida(senal.size());
+    std::vector<T> bloque(tamanoBloque_);
+    
+    for (size_t inicio = 0; inicio < senal.size(); inicio += tamanoBloque_) {
+        size_t cantidad = std::min((size_t)tamanoBloque_, senal.size() - inicio);
+        
+        if (cantidad == (size_t)tamanoBloque_) {
+            procesarBloque(senal.data() + inicio, salida.data() + inicio);
+        } else {
+            // Último bloque incompleto: completar con ceros
+            std::copy(senal.begin() + inicio, senal.end(), bloque.begin());
+            std::fill(bloque.begin() + cantidad, bloque.end(), T(0));
+            procesarBloque(bloque.data(), bloque.data());
+            std::copy(bloque.begin(), bloque.begin() + cantidad, salida.begin() + inicio);
+        }
+    }
+    
+    return salida;
+}
+
+template <typename T>
+void ConvolucionFFT<T>::reiniciar() {
+    std::fill(estado_.begin(), estado_.end(), T(0));
+}
+
+// Instancias usadas por el proyecto
+template class ConvolucionFFT<float>;
+template class ConvolucionFFT<double>;
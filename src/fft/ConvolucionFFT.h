@@ -0,0 +1,55 @@
+#ifndef CONVOLUCION_FFT_H
+#define CONVOLUCION_FFT_H
+
+#include <vector>
+#include "PlanFFTReal.h"
+#include "../utilidades/NumeroComplejo.h"
+
+// Convolución rápida de una señal real con un filtro FIR largo mediante FFT.
+// La señal se procesa en bloques de tamanoBloque() muestras: cada bloque se
+// transforma, se multiplica por el espectro del filtro (calculado una sola
+// vez) y se vuelve al tiempo con la FFT inversa real. El coste por muestra es
+// O(log N) en lugar de O(número de coeficientes).
+// T es el tipo escalar (float o double).
+template <typename T>
+class ConvolucionFFT {
+public:
+    enum class Metodo {
+        SolapamientoSuma,       // Overlap-add: suma la cola de cada bloque al siguiente
+        SolapamientoDescarte    // Overlap-save: descarta las primeras muestras circulares
+    };
+    
+    // Preparar la convolución con los coeficientes del filtro. Si no se indica
+    // el tamaño de la FFT se usa la potencia de 2 >= 4 veces el número de coeficientes.
+    explicit ConvolucionFFT(const std::vector<T>& coeficientes,
+                            Metodo metodo = Metodo::SolapamientoSuma,
+                            int tamanoFFT = 0);
+    
+    // Filtrar un bloque de exactamente tamanoBloque() muestras. El estado entre
+    // bloques se conserva, así que la salida es la convolución lineal causal de
+    // toda la secuencia de bloques (entrada y salida pueden coincidir).
+    void procesarBloque(const T* entrada, T* salida);
+    
+    // Filtrar una señal completa desde el estado inicial. La salida tiene el
+    // mismo tamaño que la entrada (convolución causal, con el retardo del filtro).
+    std::vector<T> aplicar(const std::vector<T>& senal);
+    
+    // Volver al estado inicial (señal previa nula)
+    void reiniciar();
+    
+    int tamanoBloque() const { return tamanoBloque_; }
+    int tamanoFFT() const { return plan_.tamano(); }
+    int numCoeficientes() const { return numCoeficientes_; }
+    
+private:
+    int numCoeficientes_;
+    int tamanoBloque_;
+    Metodo metodo_;
+    PlanFFTReal<T> plan_;
+    std::vector<NumeroComplejo<T>> espectroFiltro_;
+    std::vector<T> estado_;         // Cola (suma) o historia de la entrada (descarte), L - 1 muestras
+    std::vector<T> bufer_;          // Trama de tamanoFFT() muestras
+    std::vector<NumeroComplejo<T>> espectro_;
+};
+
+#endif
@@ -1,20 +1,96 @@
 #include "FFT.h"
 #include <cmath>
 #include <stdexcept>
+#include <memory>
+#include <unordered_map>
 
 const double PI = 3.14159265358979323846;
 
-void FFT::calcular(std::vector<NumeroComplejo>& datos) {
+template <typename T>
+void FFT::calcular(std::vector<NumeroComplejo<T>>& datos) {
     int n = datos.size();
     
-    if (!esPotenciaDeDos(n)) {
-        throw std::invalid_argument("El tamaño de la FFT debe ser una potencia de 2");
+    if (n < 1) {
+        throw std::invalid_argument("La FFT necesita al menos un elemento");
     }
     
-    fftRecursivo(datos);
+    obtenerPlan<T>(n).ejecutar(datos);
 }
 
-void FFT::fftRecursivo(std::vector<NumeroComplejo>& datos) {
+template <typename T>
+void FFT::inversa(std::vector<NumeroComplejo<T>>& datos) {
+    int n = datos.size();
+    
+    if (n < 1) {
+        throw std::invalid_argument("La FFT necesita al menos un elemento");
+    }
+    
+    // IFFT(X) = conj(FFT(conj(X))) / N
+    for (auto& valor : datos) {
+        valor.imaginario = -valor.imaginario;
+    }
+    
+    obtenerPlan<T>(n).ejecutar(datos);
+    
+    T escala = T(1) / n;
+    for (auto& valor : datos) {
+        valor = NumeroComplejo<T>(valor.real * escala, -valor.imaginario * escala);
+    }
+}
+
+template <typename T>
+std::vector<T> FFT::inversaReal(const std::vector<NumeroComplejo<T>>& espectro, int tamano) {
+    std::vector<T> muestras;
+    obtenerPlanReal<T>(tamano).ejecutarInversa(espectro, muestras);
+    return muestras;
+}
+
+template <typename T>
+void FFT::calcularLote(std::vector<NumeroComplejo<T>>& tramas, int cantidad) {
+    if (cantidad <= 0 || tramas.size() % cantidad != 0) {
+        throw std::invalid_argument("El lote debe contener tramas completas del mismo tamaño");
+    }
+    
+    int n = tramas.size() / cantidad;
+    if (n < 1) {
+        throw std::invalid_argument("La FFT necesita al menos un elemento");
+    }
+    
+    obtenerPlan<T>(n).ejecutarLote(tramas.data(), cantidad);
+}
+
+template <typename T>
+std::vector<NumeroComplejo<T>> FFT::calcularReal(const std::vector<T>& muestras) {
+    std::vector<NumeroComplejo<T>> espectro;
+    obtenerPlanReal<T>(muestras.size()).ejecutar(muestras, espectro);
+    return espectro;
+}
+
+template <typename T>
+const PlanFFT<T>& FFT::obtenerPlan(int tamano) {
+    // Caché de planes por hilo: un plan por tamaño, construido una sola vez
+    thread_local std::unordered_map<int, std::unique_ptr<PlanFFT<T>>> planes;
+    
+    auto& plan = planes[tamano];
+    if (!plan) {
+        plan = std::make_unique<PlanFFT<T>>(tamano);
+    }
+    return *plan;
+}
+
+template <typename T>
+const PlanFFTReal<T>& FFT::obtenerPlanReal(int tamano) {
+    thread_local std::unordered_map<int, std::unique_ptr<PlanFFTReal<T>>> planes;
+    
+    auto& plan = planes[tamano];
+    if (!plan) {
+        plan = std::make_unique<PlanFFTReal<T>>(tamano);
+    }
+    return *plan;
+}
+
+template <typename T>
+void FFT::fftRecursivo(std::vector<NumeroComplejo<T>>& datos) {
     int N = datos.size();
     
     // Caso base: si el tamaño es 1, ya está resuelto
@@ -23,8 +99,8 @@ void FFT::fftRecursivo(std::vector<NumeroComplejo>& datos) {
     }
     
     // Dividir en pares e impares
-    std::vector<NumeroComplejo> pares(N / 2);
-    std::vector<NumeroComplejo> impares(N / 2);
+    std::vector<NumeroComplejo<T>> pares(N / 2);
+    std::vector<NumeroComplejo<T>> impares(N / 2);
     
     for (int i = 0; i < N / 2; i++) {
         pares[i] = datos[i * 2];
@@ -38,8 +114,8 @@ void FFT::fftRecursivo(std::vector<NumeroComplejo>& datos) {
     // Combinar resultados
     for (int k = 0; k < N / 2; k++) {
         // Factor de giro: e^(-2πik/N)
-        double angulo = -2.0 * PI * k / N;
-        NumeroComplejo t = NumeroComplejo::desdePolares(1.0, angulo) * impares[k];
+        T angulo = (T)(-2.0 * PI * k / N);
+        NumeroComplejo<T> t = NumeroComplejo<T>::desdePolares(T(1), angulo) * impares[k];
         
         datos[k] = pares[k] + t;
         datos[k + N / 2] = pares[k] - t;
@@ -56,4 +132,22 @@ int FFT::siguientePotenciaDeDos(int n) {
         potencia *= 2;
     }
     return potencia;
-}
\ No newline at end of file
+}
+
+// Instancias usadas por el proyecto
+template void FFT::calcular<float>(std::vector<NumeroComplejo<float>>&);
+template void FFT::calcular<double>(std::vector<NumeroComplejo<double>>&);
+template void FFT::inversa<float>(std::vector<NumeroComplejo<float>>&);
+template void FFT::inversa<double>(std::vector<NumeroComplejo<double>>&);
+template std::vector<float> FFT::inversaReal<float>(const std::vector<NumeroComplejo<float>>&, int);
+template std::vector<double> FFT::inversaReal<double>(const std::vector<NumeroComplejo<double>>&, int);
+template void FFT::calcularLote<float>(std::vector<NumeroComplejo<float>>&, int);
+template void FFT::calcularLote<double>(std::vector<NumeroComplejo<double>>&, int);
+template std::vector<NumeroComplejo<float>> FFT::calcularReal<float>(const std::vector<float>&);
+template std::vector<NumeroComplejo<double>> FFT::calcularReal<double>(const std::vector<double>&);
+template const PlanFFT<float>& FFT::obtenerPlan<float>(int);
+template const PlanFFT<double>& FFT::obtenerPlan<double>(int);
+template const PlanFFTReal<float>& FFT::obtenerPlanReal<float>(int);
+template const PlanFFTReal<double>& FFT::obtenerPlanReal<double>(int);
+template void FFT::fftRecursivo<float>(std::vector<NumeroComplejo<float>>&);
+template void FFT::fftRecursivo<double>(std::vector<NumeroComplejo<double>>&);
@@ -2,12 +2,42 @@
 #define FFT_H
 
 #include <vector>
+#include "PlanFFT.h"
+#include "PlanFFTReal.h"
 #include "../utilidades/NumeroComplejo.h"
 
+// Todas las operaciones están disponibles en precisión simple (float) y doble (double)
 class FFT {
 public:
-    // FFT principal usando algoritmo Cooley-Tukey
-    static void calcular(std::vector<NumeroComplejo>& datos);
+    // FFT principal de cualquier tamaño (Cooley-Tukey radix 2 o mixto, o Bluestein)
+    template <typename T>
+    static void calcular(std::vector<NumeroComplejo<T>>& datos);
+    
+    // FFT inversa in-place (incluye el factor 1/N)
+    template <typename T>
+    static void inversa(std::vector<NumeroComplejo<T>>& datos);
+    
+    // FFT inversa de un espectro hermítico dado por sus N/2 + 1 bins no
+    // redundantes: devuelve las 'tamano' muestras reales
+    template <typename T>
+    static std::vector<T> inversaReal(const std::vector<NumeroComplejo<T>>& espectro, int tamano);
+    
+    // FFT por lotes: 'tramas' contiene 'cantidad' tramas contiguas del mismo
+    // tamaño que se transforman in-place de forma entrelazada
+    template <typename T>
+    static void calcularLote(std::vector<NumeroComplejo<T>>& tramas, int cantidad);
+    
+    // FFT de una señal real: devuelve sólo los N/2 + 1 bins no redundantes
+    template <typename T>
+    static std::vector<NumeroComplejo<T>> calcularReal(const std::vector<T>& muestras);
+    
+    // Obtener el plan para un tamaño (se construye la primera vez y se reutiliza)
+    template <typename T>
+    static const PlanFFT<T>& obtenerPlan(int tamano);
+    
+    // Obtener el plan de FFT real para un tamaño (también se reutiliza)
+    template <typename T>
+    static const PlanFFTReal<T>& obtenerPlanReal(int tamano);
     
     // Verificar si un número es potencia de 2
     static bool esPotenciaDeDos(int n);
@@ -15,9 +45,10 @@ public:
     // Obtener la siguiente potencia de 2
     static int siguientePotenciaDeDos(int n);
     
-private:
-    // Implementación recursiva del algoritmo Cooley-Tukey
-    static void fftRecursivo(std::vector<NumeroComplejo>& datos);
+    // Implementación recursiva del algoritmo Cooley-Tukey (versión de
+    // referencia para comparar en bench_fft; el tamaño debe ser potencia de 2)
+    template <typename T>
+    static void fftRecursivo(std::vector<NumeroComplejo<T>>& datos);
 };
 
-#endif
\ No newline at end of file
+#endif
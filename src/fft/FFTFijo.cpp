@@ -0,0 +1,99 @@
+#include "FFTFijo.h"
+#include "TablasFFTFijo.h"
+#include <algorithm>
+
+namespace {
+// Índice de un tamaño complejo en las tablas de etapas fijas de NucleosFFT
+constexpr int indiceFijo(int tamanoComplejo) {
+    int log2 = 0;
+    while ((1 << log2) < tamanoComplejo) {
+        log2++;
+    }
+    return log2 - NucleosFFT::log2MinimoFijo;
+}
+}
+
+template <typename T, int N>
+FFTFijo<T, N>::FFTFijo(const NucleosFFT::Tabla* nucleos)
+    : loteRe_((size_t)M * B), loteIm_((size_t)M * B) {
+    static_assert(indiceFijo(M) >= 0 && indiceFijo(M) < NucleosFFT::numTamanosFijos,
+                  "Tamaño sin etapas fijas en NucleosFFT");
+    
+    const NucleosFFT::Tabla& tabla = nucleos ? *nucleos : NucleosFFT::activos();
+    etapas_ = tabla.template etapasFijas<T>(indiceFijo(M));
+}
+
+template <typename T, int N>
+void FFTFijo<T, N>::ejecutarLote(const T* entrada, int cantidad, NumeroComplejo<T>* salida) const {
+    using Tablas = TablasFFTFijo<T, M>;
+    
+    T* re = loteRe_.data();
+    T* im = loteIm_.data();
+    
+    for (int primera = 0; primera < cantidad; primera += B) {
+        int enBloque = std::min(B, cantidad - primera);
+        const T* bloque = entrada + (size_t)primera * N;
+        
+        // Empaquetar z[n] = x[2n] + i·x[2n+1] y entrelazar en orden de inversión de bits
+        for (int i = 0; i < M; i++) {
+            const T* origen = bloque + 2 * Tablas::inversionBits[i];
+            T* destinoRe = re + (size_t)i * B;
+            T* destinoIm = im + (size_t)i * B;
+            for (int f = 0; f < enBloque; f++) {
+                destinoRe[f] = origen[(size_t)f * N];
+                destinoIm[f] = origen[(size_t)f * N + 1];
+            }
+            for (int f = enBloque; f < B; f++) {
+                destinoRe[f] = T(0);
+                destinoIm[f] = T(0);
+            }
+        }
+        
+        etapas_(re, im);
+        
+        // Separar los espectros par e impar (ver PlanFFTReal::separarEspectros)
+        NumeroComplejo<T>* destino = salida + (size_t)primera * numBins();
+        for (int f = 0; f < enBloque; f++) {
+            NumeroComplejo<T>* X = destino + (size_t)f * numBins();
+            X[0] = NumeroComplejo<T>(re[f] + im[f], T(0));
+            X[M] = NumeroComplejo<T>(re[f] - im[f], T(0));
+        }
+        
+        for (int k = 1; k <= M / 2; k++) {
+            const T* zkRe = re + (size_t)k * B;
+            const T* zkIm = im + (size_t)k * B;
+            const T* zmRe = re + (size_t)(M - k) * B;
+            const T* zmIm = im + (size_t)(M - k) * B;
+            const T wRe = Tablas::separacionRe[k];
+            const T wIm = Tablas::separacionIm[k];
+            
+            for (int f = 0; f < enBloque; f++) {
+                T feRe = T(0.5) * (zkRe[f] + zmRe[f]);
+                T feIm = T(0.5) * (zkIm[f] - zmIm[f]);
+                T foRe = T(0.5) * (zkIm[f] + zmIm[f]);
+                T foIm = -T(0.5) * (zkRe[f] - zmRe[f]);
+                
+                T tRe = wRe * foRe - wIm * foIm;
+                T tIm = wRe * foIm + wIm * foRe;
+                
+                NumeroComplejo<T>* X = destino + (size_t)f * numBins();
+                X[k].real = feRe + tRe;
+                X[k].imaginario = feIm + tIm;
+                X[M - k].real = feRe - tRe;
+                X[M - k].imaginario = tIm - feIm;
+            }
+        }
+    }
+}
+
+// Instancias usadas por el proyecto
+template class FFTFijo<float, 256>;
+template class FFTFijo<float, 512>;
+template class FFTFijo<float, 1024>;
+template class FFTFijo<float, 2048>;
+template class FFTFijo<float, 4096>;
+template class FFTFijo<double, 256>;
+template class FFTFijo<double, 512>;
+template class FFTFijo<double, 1024>;
+template class FFTFijo<double, 2048>;
+template class FFTFijo<double, 4096>;
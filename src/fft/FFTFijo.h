@@ -0,0 +1,41 @@
+#ifndef FFT_FIJO_H
+#define FFT_FIJO_H
+
+#include <vector>
+#include "NucleosFFT.h"
+#include "PlanFFT.h"
+#include "../utilidades/NumeroComplejo.h"
+
+// FFT de entrada real con el tamaño N fijado en compilación (potencia de 2
+// entre 256 y 4096). Misma interfaz por lotes que PlanFFTReal, pero la
+// inversión de bits y todos los factores de giro son tablas constexpr
+// (TablasFFTFijo) y las etapas están especializadas para N/2 complejos y
+// lotes de PlanFFT<T>::anchoLote tramas, sin ramas ni límites en tiempo de
+// ejecución. Espectrograma lo elige automáticamente para estos tamaños.
+// T es el tipo escalar (float o double).
+template <typename T, int N>
+class FFTFijo {
+public:
+    static_assert(N >= 256 && N <= 4096 && (N & (N - 1)) == 0,
+                  "FFTFijo sólo está disponible para potencias de 2 entre 256 y 4096");
+    
+    // Usar los núcleos indicados o, si no se indican, los mejores que soporte la CPU
+    explicit FFTFijo(const NucleosFFT::Tabla* nucleos = nullptr);
+    
+    // Transformar 'cantidad' tramas reales contiguas de N muestras. 'salida'
+    // recibe 'cantidad' bloques consecutivos de numBins() bins.
+    void ejecutarLote(const T* entrada, int cantidad, NumeroComplejo<T>* salida) const;
+    
+    static constexpr int tamano() { return N; }
+    static constexpr int numBins() { return N / 2 + 1; }
+    
+private:
+    static constexpr int M = N / 2;                      // Tamaño de la FFT compleja
+    static constexpr int B = PlanFFT<T>::anchoLote;      // Tramas por lote
+    
+    NucleosFFT::FuncionEtapasFijas<T> etapas_;
+    mutable std::vector<T> loteRe_;                      // Búfer entrelazado (M × B)
+    mutable std::vector<T> loteIm_;
+};
+
+#endif
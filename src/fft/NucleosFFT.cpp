@@ -0,0 +1,149 @@
+#include "NucleosFFT.h"
+#include "NucleosFFTVectorial.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define NUCLEOS_FFT_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace {
+// "Registro" de un solo carril: la misma implementación genérica en escalar
+template <typename T>
+struct RegistroEscalar {
+    using Escalar = T;
+    using Registro = T;
+    static constexpr int ancho = 1;
+    
+    static Registro cargar(const T* p) { return *p; }
+    static void guardar(T* p, Registro v) { *p = v; }
+    static Registro difundir(T x) { return x; }
+    static Registro sumar(Registro a, Registro b) { return a + b; }
+    static Registro restar(Registro a, Registro b) { return a - b; }
+    static Registro multiplicar(Registro a, Registro b) { return a * b; }
+};
+
+template <typename T>
+void etapasEscalar(T* re, T* im, int n, const T* giroRe, const T* giroIm) {
+    etapasRadix2Vectorial<RegistroEscalar<T>>(re, im, n, giroRe, giroIm);
+}
+
+template <typename T>
+void etapasLoteEscalar(T* re, T* im, int n, int ancho, const T* giroRe, const T* giroIm) {
+    etapasRadix2LoteVectorial<RegistroEscalar<T>>(re, im, n, ancho, giroRe, giroIm);
+}
+
+#ifdef NUCLEOS_FFT_X86
+struct RegistrosCPUID {
+    unsigned int eax, ebx, ecx, edx;
+};
+
+RegistrosCPUID cpuid(unsigned int hoja, unsigned int subhoja) {
+    RegistrosCPUID r = {0, 0, 0, 0};
+#if defined(_MSC_VER)
+    int valores[4];
+    __cpuidex(valores, (int)hoja, (int)subhoja);
+    r.eax = valores[0]; r.ebx = valores[1]; r.ecx = valores[2]; r.edx = valores[3];
+#else
+    if (hoja > __get_cpuid_max(0, nullptr)) {
+        return r;
+    }
+    __cpuid_count(hoja, subhoja, r.eax, r.ebx, r.ecx, r.edx);
+#endif
+    return r;
+}
+
+// Estados de registros que el sistema operativo guarda en los cambios de contexto
+unsigned long long leerXCR0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned int bajo, alto;
+    __asm__ volatile("xgetbv" : "=a"(bajo), "=d"(alto) : "c"(0));
+    return ((unsigned long long)alto << 32) | bajo;
+#endif
+}
+#endif
+}
+
+const NucleosFFT::Tabla* NucleosFFT::tablaEscalar() {
+    static const Tabla tabla = {
+        Conjunto::Escalar, "Escalar",
+        etapasEscalar<double>, etapasEscalar<float>, etapasLoteEscalar<double>, etapasLoteEscalar<float>,
+        etapasFijasVectoriales<RegistroEscalar<double>>(), etapasFijasVectoriales<RegistroEscalar<float>>(),
+        potenciaVectorial<RegistroEscalar<double>>, potenciaVectorial<RegistroEscalar<float>>
+    };
+    return &tabla;
+}
+
+bool NucleosFFT::cpuSoporta(Conjunto conjunto) {
+    if (conjunto == Conjunto::Escalar) {
+        return true;
+    }
+    
+#ifdef NUCLEOS_FFT_X86
+    RegistrosCPUID hoja1 = cpuid(1, 0);
+    bool sse2 = (hoja1.edx >> 26) & 1;
+    if (conjunto == Conjunto::SSE2) {
+        return sse2;
+    }
+    
+    // AVX requiere que el SO guarde los registros YMM (XCR0 bits 1 y 2)
+    bool osxsave = (hoja1.ecx >> 27) & 1;
+    bool avx = (hoja1.ecx >> 28) & 1;
+    if (!sse2 || !osxsave || !avx) {
+        return false;
+    }
+    unsigned long long xcr0 = leerXCR0();
+    if ((xcr0 & 0x6) != 0x6) {
+        return false;
+    }
+    
+    RegistrosCPUID hoja7 = cpuid(7, 0);
+    if (conjunto == Conjunto::AVX2) {
+        return (hoja7.ebx >> 5) & 1;
+    }
+    
+    // AVX-512 requiere además los estados opmask y ZMM (XCR0 bits 5, 6 y 7)
+    if (conjunto == Conjunto::AVX512) {
+        return ((hoja7.ebx >> 16) & 1) && (xcr0 & 0xE0) == 0xE0;
+    }
+#endif
+    
+    return false;
+}
+
+const NucleosFFT::Tabla* NucleosFFT::obtener(Conjunto conjunto) {
+    // Consultar la CPU antes de tocar código compilado para otro conjunto
+    if (!cpuSoporta(conjunto)) {
+        return nullptr;
+    }
+    
+    switch (conjunto) {
+        case Conjunto::Escalar: return tablaEscalar();
+        case Conjunto::SSE2:    return tablaSSE2();
+        case Conjunto::AVX2:    return tablaAVX2();
+        case Conjunto::AVX512:  return tablaAVX512();
+    }
+    return nullptr;
+}
+
+const NucleosFFT::Tabla& NucleosFFT::activos() {
+    // Detección única: el mejor conjunto disponible en esta CPU
+    static const Tabla* mejor = [] {
+        const Conjunto preferencia[] = {
+            Conjunto::AVX512, Conjunto::AVX2, Conjunto::SSE2, Conjunto::Escalar
+        };
+        for (Conjunto c : preferencia) {
+            if (const Tabla* tabla = obtener(c)) {
+                return tabla;
+            }
+        }
+        return tablaEscalar();
+    }();
+    return *mejor;
+}
@@ -0,0 +1,101 @@
+#ifndef NUCLEOS_FFT_H
+#define NUCLEOS_FFT_H
+
+#include <array>
+#include <type_traits>
+
+// Núcleos de mariposas de la FFT (float y double) sobre datos SoA (partes real e imaginaria en
+// arreglos separados). Hay una variante escalar y variantes SSE2/AVX2/AVX-512
+// compiladas en unidades de traducción propias; la mejor variante soportada
+// por la CPU se elige en tiempo de ejecución mediante CPUID.
+class NucleosFFT {
+public:
+    // Conjuntos de instrucciones disponibles (de menor a mayor preferencia)
+    enum class Conjunto { Escalar, SSE2, AVX2, AVX512 };
+    
+    // Ejecutar todas las etapas radix 2 sobre 'n' datos ya reordenados por
+    // inversión de bits. Los factores de giro de la etapa con mitad m empiezan
+    // en el índice m - 1 (tabla de n - 1 elementos).
+    template <typename T>
+    using FuncionEtapas = void (*)(T* re, T* im, int n, const T* giroRe, const T* giroIm);
+    
+    // Igual que FuncionEtapas pero sobre 'ancho' tramas entrelazadas: el
+    // elemento i de la trama f está en la posición i * ancho + f
+    template <typename T>
+    using FuncionEtapasLote = void (*)(T* re, T* im, int n, int ancho,
+                                       const T* giroRe, const T* giroIm);
+    
+    // Etapas por lotes especializadas en compilación para un tamaño fijo: el
+    // tamaño, el ancho del lote (64 / sizeof(T) tramas) y los factores de giro
+    // (TablasFFTFijo) son constantes. Hay una por tamaño n = 2^(log2MinimoFijo + i).
+    template <typename T>
+    using FuncionEtapasFijas = void (*)(T* re, T* im);
+    
+    // Potencia |z|² de 'n' complejos intercalados (re, im, re, im, ...)
+    template <typename T>
+    using FuncionPotencia = void (*)(const T* intercalado, T* potencia, int n);
+    
+    static constexpr int log2MinimoFijo = 7;     // 128 complejos (FFT real de 256)
+    static constexpr int numTamanosFijos = 5;    // hasta 2048 complejos (FFT real de 4096)
+    
+    struct Tabla {
+        Conjunto conjunto;
+        const char* nombre;
+        FuncionEtapas<double> etapasDoble;
+        FuncionEtapas<float> etapasSimple;
+        FuncionEtapasLote<double> etapasLoteDoble;
+        FuncionEtapasLote<float> etapasLoteSimple;
+        std::array<FuncionEtapasFijas<double>, numTamanosFijos> etapasFijasDoble;
+        std::array<FuncionEtapasFijas<float>, numTamanosFijos> etapasFijasSimple;
+        FuncionPotencia<double> potenciaDoble;
+        FuncionPotencia<float> potenciaSimple;
+        
+        // Variante según el tipo escalar
+        void etapas(double* re, double* im, int n, const double* giroRe, const double* giroIm) const {
+            etapasDoble(re, im, n, giroRe, giroIm);
+        }
+        void etapas(float* re, float* im, int n, const float* giroRe, const float* giroIm) const {
+            etapasSimple(re, im, n, giroRe, giroIm);
+        }
+        void etapasLote(double* re, double* im, int n, int ancho,
+                        const double* giroRe, const double* giroIm) const {
+            etapasLoteDoble(re, im, n, ancho, giroRe, giroIm);
+        }
+        void etapasLote(float* re, float* im, int n, int ancho,
+                        const float* giroRe, const float* giroIm) const {
+            etapasLoteSimple(re, im, n, ancho, giroRe, giroIm);
+        }
+        void potencia(const double* intercalado, double* salida, int n) const {
+            potenciaDoble(intercalado, salida, n);
+        }
+        void potencia(const float* intercalado, float* salida, int n) const {
+            potenciaSimple(intercalado, salida, n);
+        }
+        template <typename T>
+        FuncionEtapasFijas<T> etapasFijas(int indice) const {
+            if constexpr (std::is_same<T, double>::value) {
+                return etapasFijasDoble[indice];
+            } else {
+                return etapasFijasSimple[indice];
+            }
+        }
+    };
+    
+    // Mejor conjunto soportado por la CPU (se detecta una sola vez)
+    static const Tabla& activos();
+    
+    // Núcleos de un conjunto concreto (nullptr si no está compilado o la CPU no lo soporta)
+    static const Tabla* obtener(Conjunto conjunto);
+    
+    // Verificar si la CPU actual soporta un conjunto de instrucciones
+    static bool cpuSoporta(Conjunto conjunto);
+    
+private:
+    // Tablas definidas en cada unidad de traducción (nullptr si no se compiló)
+    static const Tabla* tablaEscalar();
+    static const Tabla* tablaSSE2();
+    static const Tabla* tablaAVX2();
+    static const Tabla* tablaAVX512();
+};
+
+#endif
@@ -0,0 +1,69 @@
+// Núcleos AVX2 (4 doubles u 8 floats por registro). Este archivo se compila con
+// -mavx2 (/arch:AVX2 en MSVC) y sólo se usa si CPUID confirma soporte.
+#include "NucleosFFT.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#include "NucleosFFTVectorial.h"
+
+namespace {
+struct RegistroAVX2d {
+    using Escalar = double;
+    using Registro = __m256d;
+    static constexpr int ancho = 4;
+    
+    static Registro cargar(const double* p) { return _mm256_loadu_pd(p); }
+    static void guardar(double* p, Registro v) { _mm256_storeu_pd(p, v); }
+    static Registro difundir(double x) { return _mm256_set1_pd(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm256_add_pd(a, b); }
+    static Registro restar(Registro a, Registro b) { return _mm256_sub_pd(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm256_mul_pd(a, b); }
+};
+
+struct RegistroAVX2f {
+    using Escalar = float;
+    using Registro = __m256;
+    static constexpr int ancho = 8;
+    
+    static Registro cargar(const float* p) { return _mm256_loadu_ps(p); }
+    static void guardar(float* p, Registro v) { _mm256_storeu_ps(p, v); }
+    static Registro difundir(float x) { return _mm256_set1_ps(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm256_add_ps(a, b); }
+    static Registro restar(Registro a, Registro b) { return _mm256_sub_ps(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm256_mul_ps(a, b); }
+};
+
+void etapasAVX2d(double* re, double* im, int n, const double* giroRe, const double* giroIm) {
+    etapasRadix2Vectorial<RegistroAVX2d>(re, im, n, giroRe, giroIm);
+}
+
+void etapasLoteAVX2d(double* re, double* im, int n, int ancho, const double* giroRe, const double* giroIm) {
+    etapasRadix2LoteVectorial<RegistroAVX2d>(re, im, n, ancho, giroRe, giroIm);
+}
+
+void etapasAVX2f(float* re, float* im, int n, const float* giroRe, const float* giroIm) {
+    etapasRadix2Vectorial<RegistroAVX2f>(re, im, n, giroRe, giroIm);
+}
+
+void etapasLoteAVX2f(float* re, float* im, int n, int ancho, const float* giroRe, const float* giroIm) {
+    etapasRadix2LoteVectorial<RegistroAVX2f>(re, im, n, ancho, giroRe, giroIm);
+}
+}
+
+const NucleosFFT::Tabla* NucleosFFT::tablaAVX2() {
+    static const Tabla tabla = {
+        Conjunto::AVX2, "AVX2",
+        etapasAVX2d, etapasAVX2f, etapasLoteAVX2d, etapasLoteAVX2f,
+        etapasFijasVectoriales<RegistroAVX2d>(), etapasFijasVectoriales<RegistroAVX2f>(),
+        potenciaVectorial<RegistroAVX2d>, potenciaVectorial<RegistroAVX2f>
+    };
+    return &tabla;
+}
+
+#else
+
+const NucleosFFT::Tabla* NucleosFFT::tablaAVX2() {
+    return nullptr;
+}
+
+#endif
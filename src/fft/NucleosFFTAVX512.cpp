@@ -0,0 +1,69 @@
+// Núcleos AVX-512 (8 doubles o 16 floats por registro). Este archivo se compila con
+// -mavx512f (/arch:AVX512 en MSVC) y sólo se usa si CPUID confirma soporte.
+#include "NucleosFFT.h"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#include "NucleosFFTVectorial.h"
+
+namespace {
+struct RegistroAVX512d {
+    using Escalar = double;
+    using Registro = __m512d;
+    static constexpr int ancho = 8;
+    
+    static Registro cargar(const double* p) { return _mm512_loadu_pd(p); }
+    static void guardar(double* p, Registro v) { _mm512_storeu_pd(p, v); }
+    static Registro difundir(double x) { return _mm512_set1_pd(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm512_add_pd(a, b); }
+    static Registro restar(Registro a, Registro b) { return _mm512_sub_pd(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm512_mul_pd(a, b); }
+};
+
+struct RegistroAVX512f {
+    using Escalar = float;
+    using Registro = __m512;
+    static constexpr int ancho = 16;
+    
+    static Registro cargar(const float* p) { return _mm512_loadu_ps(p); }
+    static void guardar(float* p, Registro v) { _mm512_storeu_ps(p, v); }
+    static Registro difundir(float x) { return _mm512_set1_ps(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm512_add_ps(a, b); }
+    static Registro restar(Registro a, Registro b) { return _mm512_sub_ps(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm512_mul_ps(a, b); }
+};
+
+void etapasAVX512d(double* re, double* im, int n, const double* giroRe, const double* giroIm) {
+    etapasRadix2Vectorial<RegistroAVX512d>(re, im, n, giroRe, giroIm);
+}
+
+void etapasLoteAVX512d(double* re, double* im, int n, int ancho, const double* giroRe, const double* giroIm) {
+    etapasRadix2LoteVectorial<RegistroAVX512d>(re, im, n, ancho, giroRe, giroIm);
+}
+
+void etapasAVX512f(float* re, float* im, int n, const float* giroRe, const float* giroIm) {
+    etapasRadix2Vectorial<RegistroAVX512f>(re, im, n, giroRe, giroIm);
+}
+
+void etapasLoteAVX512f(float* re, float* im, int n, int ancho, const float* giroRe, const float* giroIm) {
+    etapasRadix2LoteVectorial<RegistroAVX512f>(re, im, n, ancho, giroRe, giroIm);
+}
+}
+
+const NucleosFFT::Tabla* NucleosFFT::tablaAVX512() {
+    static const Tabla tabla = {
+        Conjunto::AVX512, "AVX-512",
+        etapasAVX512d, etapasAVX512f, etapasLoteAVX512d, etapasLoteAVX512f,
+        etapasFijasVectoriales<RegistroAVX512d>(), etapasFijasVectoriales<RegistroAVX512f>(),
+        potenciaVectorial<RegistroAVX512d>, potenciaVectorial<RegistroAVX512f>
+    };
+    return &tabla;
+}
+
+#else
+
+const NucleosFFT::Tabla* NucleosFFT::tablaAVX512() {
+    return nullptr;
+}
+
+#endif
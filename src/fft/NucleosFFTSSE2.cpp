@@ -0,0 +1,68 @@
+// Núcleos SSE2 (2 doubles o 4 floats por registro)
+#include "NucleosFFT.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#include "NucleosFFTVectorial.h"
+
+namespace {
+struct RegistroSSE2d {
+    using Escalar = double;
+    using Registro = __m128d;
+    static constexpr int ancho = 2;
+    
+    static Registro cargar(const double* p) { return _mm_loadu_pd(p); }
+    static void guardar(double* p, Registro v) { _mm_storeu_pd(p, v); }
+    static Registro difundir(double x) { return _mm_set1_pd(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm_add_pd(a, b); }
+    static Registro restar(Registro a, Registro b) { return _mm_sub_pd(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm_mul_pd(a, b); }
+};
+
+struct RegistroSSE2f {
+    using Escalar = float;
+    using Registro = __m128;
+    static constexpr int ancho = 4;
+    
+    static Registro cargar(const float* p) { return _mm_loadu_ps(p); }
+    static void guardar(float* p, Registro v) { _mm_storeu_ps(p, v); }
+    static Registro difundir(float x) { return _mm_set1_ps(x); }
+    static Registro sumar(Registro a, Registro b) { return _mm_add_ps(a, b); }
+    static Registro restar(Registro a, Registro b) { return _mm_sub_ps(a, b); }
+    static Registro multiplicar(Registro a, Registro b) { return _mm_mul_ps(a, b); }
+};
+
+void etapasSSE2d(double* re, double* im, int n, const double* giroRe, const double* giroIm) {
+    etapasRadix2Vectorial<RegistroSSE2d>(re, im, n, giroRe, giroIm);
+}
+
+void etapasLoteSSE2d(double* re, double* im, int n, int ancho, const double* giroRe, const double* giroIm) {
+    etapasRadix2LoteVectorial<RegistroSSE2d>(re, im, n, ancho, giroRe, giroIm);
+}
+
+void etapasSSE2f(float* re, float* im, int n, const float* giroRe, const float* giroIm) {
+    etapasRadix2Vectorial<RegistroSSE2f>(re, im, n, giroRe, giroIm);
+}
+
+void etapasLoteSSE2f(float* re, float* im, int n, int ancho, const float* giroRe, const float* giroIm) {
+    etapasRadix2LoteVectorial<RegistroSSE2f>(re, im, n, ancho, giroRe, giroIm);
+}
+}
+
+const NucleosFFT::Tabla* NucleosFFT::tablaSSE2() {
+    static const Tabla tabla = {
+        Conjunto::SSE2, "SSE2",
+        etapasSSE2d, etapasSSE2f, etapasLoteSSE2d, etapasLoteSSE2f,
+        etapasFijasVectoriales<RegistroSSE2d>(), etapasFijasVectoriales<RegistroSSE2f>(),
+        potenciaVectorial<RegistroSSE2d>, potenciaVectorial<RegistroSSE2f>
+    };
+    return &tabla;
+}
+
+#else
+
+const NucleosFFT::Tabla* NucleosFFT::tablaSSE2() {
+    return nullptr;
+}
+
+#endif
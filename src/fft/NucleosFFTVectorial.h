@@ -0,0 +1,206 @@
+#ifndef NUCLEOS_FFT_VECTORIAL_H
+#define NUCLEOS_FFT_VECTORIAL_H
+
+#include <cstddef>
+#include <utility>
+#include "NucleosFFT.h"
+#include "TablasFFTFijo.h"
+
+// Implementación genérica de las mariposas, parametrizada por un tipo de
+// registro V que expone: Escalar, Registro, ancho, cargar, guardar, difundir,
+// sumar, restar y multiplicar. Cada unidad de traducción de núcleos la instancia
+// con sus propios tipos V (definidos en un espacio de nombres anónimo), por
+// lo que el código generado con cada conjunto de instrucciones no se mezcla.
+
+template <class V>
+void etapasRadix2Vectorial(typename V::Escalar* re, typename V::Escalar* im, int n,
+                           const typename V::Escalar* giroRe,
+                           const typename V::Escalar* giroIm) {
+    using T = typename V::Escalar;
+    using R = typename V::Registro;
+    
+    for (int mitad = 1; mitad < n; mitad *= 2) {
+        const T* wRe = giroRe + mitad - 1;
+        const T* wIm = giroIm + mitad - 1;
+        
+        if (mitad < V::ancho) {
+            // Etapas cortas: menos mariposas por grupo que carriles en el registro
+            for (int inicio = 0; inicio < n; inicio += 2 * mitad) {
+                for (int k = 0; k < mitad; k++) {
+                    int a = inicio + k;
+                    int b = a + mitad;
+                    T tRe = re[b] * wRe[k] - im[b] * wIm[k];
+                    T tIm = re[b] * wIm[k] + im[b] * wRe[k];
+                    re[b] = re[a] - tRe;
+                    im[b] = im[a] - tIm;
+                    re[a] = re[a] + tRe;
+                    im[a] = im[a] + tIm;
+                }
+            }
+            continue;
+        }
+        
+        for (int inicio = 0; inicio < n; inicio += 2 * mitad) {
+            T* aRe = re + inicio;
+            T* aIm = im + inicio;
+            T* bRe = aRe + mitad;
+            T* bIm = aIm + mitad;
+            
+            for (int k = 0; k < mitad; k += V::ancho) {
+                R wr = V::cargar(wRe + k);
+                R wi = V::cargar(wIm + k);
+                R br = V::cargar(bRe + k);
+                R bi = V::cargar(bIm + k);
+                
+                // t = w · b
+                R tr = V::restar(V::multiplicar(br, wr), V::multiplicar(bi, wi));
+                R ti = V::sumar(V::multiplicar(br, wi), V::multiplicar(bi, wr));
+                
+                R ar = V::cargar(aRe + k);
+                R ai = V::cargar(aIm + k);
+                
+                V::guardar(bRe + k, V::restar(ar, tr));
+                V::guardar(bIm + k, V::restar(ai, ti));
+                V::guardar(aRe + k, V::sumar(ar, tr));
+                V::guardar(aIm + k, V::sumar(ai, ti));
+            }
+        }
+    }
+}
+
+// Variante por lotes: 'ancho' tramas entrelazadas, el elemento i de la trama f
+// está en i * ancho + f. Cada factor de giro se carga una sola vez y se aplica
+// a todas las tramas del lote, por lo que todas las etapas (incluidas las
+// cortas) se vectorizan a lo largo de las tramas.
+template <class V>
+void etapasRadix2LoteVectorial(typename V::Escalar* re, typename V::Escalar* im, int n, int ancho,
+                               const typename V::Escalar* giroRe,
+                               const typename V::Escalar* giroIm) {
+    using T = typename V::Escalar;
+    using R = typename V::Registro;
+    
+    for (int mitad = 1; mitad < n; mitad *= 2) {
+        const T* wRe = giroRe + mitad - 1;
+        const T* wIm = giroIm + mitad - 1;
+        
+        for (int inicio = 0; inicio < n; inicio += 2 * mitad) {
+            for (int k = 0; k < mitad; k++) {
+                T* aRe = re + (size_t)(inicio + k) * ancho;
+                T* aIm = im + (size_t)(inicio + k) * ancho;
+                T* bRe = aRe + (size_t)mitad * ancho;
+                T* bIm = aIm + (size_t)mitad * ancho;
+                
+                R wr = V::difundir(wRe[k]);
+                R wi = V::difundir(wIm[k]);
+                
+                int f = 0;
+                for (; f + V::ancho <= ancho; f += V::ancho) {
+                    R br = V::cargar(bRe + f);
+                    R bi = V::cargar(bIm + f);
+                    
+                    R tr = V::restar(V::multiplicar(br, wr), V::multiplicar(bi, wi));
+                    R ti = V::sumar(V::multiplicar(br, wi), V::multiplicar(bi, wr));
+                    
+                    R ar = V::cargar(aRe + f);
+                    R ai = V::cargar(aIm + f);
+                    
+                    V::guardar(bRe + f, V::restar(ar, tr));
+                    V::guardar(bIm + f, V::restar(ai, ti));
+                    V::guardar(aRe + f, V::sumar(ar, tr));
+                    V::guardar(aIm + f, V::sumar(ai, ti));
+                }
+                
+                // Tramas sobrantes si el lote no es múltiplo del ancho del registro
+                for (; f < ancho; f++) {
+                    T tRe = bRe[f] * wRe[k] - bIm[f] * wIm[k];
+                    T tIm = bRe[f] * wIm[k] + bIm[f] * wRe[k];
+                    bRe[f] = aRe[f] - tRe;
+                    bIm[f] = aIm[f] - tIm;
+                    aRe[f] = aRe[f] + tRe;
+                    aIm[f] = aIm[f] + tIm;
+                }
+            }
+        }
+    }
+}
+
+// Variante por lotes con tamaño N y ancho de lote fijados en compilación. Cada
+// etapa es una instancia distinta (la recursión sobre Mitad desenrolla el bucle
+// de etapas), todos los límites son constantes, el bucle sobre las tramas no
+// tiene resto y los factores de giro salen de las tablas constexpr de TablasFFTFijo.
+template <class V, int N, int Ancho, int Mitad = 1>
+void etapasRadix2LoteFijas(typename V::Escalar* re, typename V::Escalar* im) {
+    static_assert(Ancho % V::ancho == 0, "El lote debe ocupar registros completos");
+    
+    if constexpr (Mitad < N) {
+        using T = typename V::Escalar;
+        using R = typename V::Registro;
+        using Tablas = TablasFFTFijo<T, N>;
+        
+        for (int inicio = 0; inicio < N; inicio += 2 * Mitad) {
+            for (int k = 0; k < Mitad; k++) {
+                T* aRe = re + (size_t)(inicio + k) * Ancho;
+                T* aIm = im + (size_t)(inicio + k) * Ancho;
+                T* bRe = aRe + (size_t)Mitad * Ancho;
+                T* bIm = aIm + (size_t)Mitad * Ancho;
+                
+                for (int f = 0; f < Ancho; f += V::ancho) {
+                    R br = V::cargar(bRe + f);
+                    R bi = V::cargar(bIm + f);
+                    R ar = V::cargar(aRe + f);
+                    R ai = V::cargar(aIm + f);
+                    
+                    if constexpr (Mitad == 1) {
+                        // Primera etapa: el único factor de giro es 1
+                        V::guardar(bRe + f, V::restar(ar, br));
+                        V::guardar(bIm + f, V::restar(ai, bi));
+                        V::guardar(aRe + f, V::sumar(ar, br));
+                        V::guardar(aIm + f, V::sumar(ai, bi));
+                    } else {
+                        R wr = V::difundir(Tablas::giroRe[Mitad - 1 + k]);
+                        R wi = V::difundir(Tablas::giroIm[Mitad - 1 + k]);
+                        
+                        R tr = V::restar(V::multiplicar(br, wr), V::multiplicar(bi, wi));
+                        R ti = V::sumar(V::multiplicar(br, wi), V::multiplicar(bi, wr));
+                        
+                        V::guardar(bRe + f, V::restar(ar, tr));
+                        V::guardar(bIm + f, V::restar(ai, ti));
+                        V::guardar(aRe + f, V::sumar(ar, tr));
+                        V::guardar(aIm + f, V::sumar(ai, ti));
+                    }
+                }
+            }
+        }
+        
+        etapasRadix2LoteFijas<V, N, Ancho, Mitad * 2>(re, im);
+    }
+}
+
+// Potencia |z|² de n complejos intercalados. Es un bucle sin dependencias que
+// el compilador vectoriza con el conjunto de instrucciones de cada unidad de
+// traducción (V sólo aporta el tipo escalar y evita mezclar instancias).
+template <class V>
+void potenciaVectorial(const typename V::Escalar* intercalado, typename V::Escalar* potencia, int n) {
+    for (int i = 0; i < n; i++) {
+        typename V::Escalar re = intercalado[2 * i];
+        typename V::Escalar im = intercalado[2 * i + 1];
+        potencia[i] = re * re + im * im;
+    }
+}
+
+// Funciones de etapas fijas de un tipo de registro para todos los tamaños de
+// NucleosFFT (2^log2MinimoFijo ... ), con lotes de una línea de caché
+template <class V, size_t... I>
+constexpr std::array<NucleosFFT::FuncionEtapasFijas<typename V::Escalar>, sizeof...(I)>
+etapasFijasVectoriales(std::index_sequence<I...>) {
+    constexpr int ancho = 64 / sizeof(typename V::Escalar);
+    return {{ &etapasRadix2LoteFijas<V, (1 << (NucleosFFT::log2MinimoFijo + (int)I)), ancho>... }};
+}
+
+template <class V>
+constexpr std::array<NucleosFFT::FuncionEtapasFijas<typename V::Escalar>, NucleosFFT::numTamanosFijos>
+etapasFijasVectoriales() {
+    return etapasFijasVectoriales<V>(std::make_index_sequence<NucleosFFT::numTamanosFijos>());
+}
+
+#endif
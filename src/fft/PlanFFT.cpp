@@ -0,0 +1,435 @@
+#include "PlanFFT.h"
+#include "FFT.h"
+#include <cmath>
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+
+namespace {
+const double PI = 3.14159265358979323846;
+
+// Descomponer n en etapas de radix 4, 2, 3 y 5 (vacío si tiene otros factores primos)
+std::vector<int> factorizarRadices(int n) {
+    std::vector<int> radices;
+    while (n % 4 == 0) {
+        radices.push_back(4);
+        n /= 4;
+    }
+    if (n % 2 == 0) {
+        radices.push_back(2);
+        n /= 2;
+    }
+    while (n % 3 == 0) {
+        radices.push_back(3);
+        n /= 3;
+    }
+    while (n % 5 == 0) {
+        radices.push_back(5);
+        n /= 5;
+    }
+    if (n != 1) {
+        radices.clear();
+    }
+    return radices;
+}
+
+// Permutación de entrada de la decimación en el tiempo: la etapa del nivel
+// indicado separa la señal en p subsecuencias x[q + p·n] cuyos espectros
+// quedan en bloques consecutivos; se aplica recursivamente a cada bloque.
+// Con todas las etapas de radix 2 resulta la inversión de bits.
+void construirPermutacion(std::vector<int>& permutacion, const std::vector<int>& radices,
+                          int nivel, int posicion, int origen, int paso, int tamano) {
+    if (tamano == 1) {
+        permutacion[posicion] = origen;
+        return;
+    }
+    
+    int p = radices[nivel];
+    int m = tamano / p;
+    for (int q = 0; q < p; q++) {
+        construirPermutacion(permutacion, radices, nivel - 1,
+                             posicion + q * m, origen + q * paso, paso * p, m);
+    }
+}
+}
+
+template <typename T>
+PlanFFT<T>::PlanFFT(int tamano, const NucleosFFT::Tabla* nucleos)
+    : tamano_(tamano), nucleos_(nucleos ? nucleos : &NucleosFFT::activos()) {
+    if (tamano < 1) {
+        throw std::invalid_argument("El tamaño de la FFT debe ser positivo");
+    }
+    
+    radices_ = factorizarRadices(tamano);
+    if (FFT::esPotenciaDeDos(tamano)) {
+        algoritmo_ = Algoritmo::Radix2;
+        radices_.clear();
+        for (int n = tamano; n > 1; n /= 2) {
+            radices_.push_back(2);
+        }
+    } else if (!radices_.empty()) {
+        algoritmo_ = Algoritmo::RadixMixto;
+    } else {
+        algoritmo_ = Algoritmo::Bluestein;
+    }
+    
+    permutacion_.resize(tamano);
+    if (algoritmo_ == Algoritmo::Bluestein) {
+        for (int i = 0; i < tamano; i++) {
+            permutacion_[i] = i;
+        }
+    } else {
+        construirPermutacion(permutacion_, radices_, (int)radices_.size() - 1, 0, 0, 1, tamano);
+    }
+    
+    if (algoritmo_ == Algoritmo::Radix2) {
+        // Factores de giro contiguos por etapa: e^(-2πik/(2m)) para k < m
+        giroRe_.resize(tamano - 1);
+        giroIm_.resize(tamano - 1);
+        for (int mitad = 1; mitad < tamano; mitad *= 2) {
+            for (int k = 0; k < mitad; k++) {
+                double angulo = -PI * k / mitad;
+                giroRe_[mitad - 1 + k] = (T)std::cos(angulo);
+                giroIm_[mitad - 1 + k] = (T)std::sin(angulo);
+            }
+        }
+    } else if (algoritmo_ == Algoritmo::RadixMixto) {
+        // Por etapa de radix p que combina subtransformadas de tamaño m:
+        // e^(-2πiqk/(p·m)) para k < m y 1 <= q < p, en el índice k·(p-1) + q-1
+        int m = 1;
+        for (int p : radices_) {
+            int longitud = p * m;
+            for (int k = 0; k < m; k++) {
+                for (int q = 1; q < p; q++) {
+                    double angulo = -2.0 * PI * q * k / longitud;
+                    giroRe_.push_back((T)std::cos(angulo));
+                    giroIm_.push_back((T)std::sin(angulo));
+                }
+            }
+            m = longitud;
+        }
+    } else {
+        // Bluestein: nk = (n² + k² - (k-n)²) / 2, así que la DFT es una
+        // convolución con el chirp, que se calcula con una FFT radix 2 de
+        // tamaño M >= 2N - 1
+        int M = FFT::siguientePotenciaDeDos(2 * tamano - 1);
+        planInterno_ = std::make_unique<PlanFFT<T>>(M, nucleos_);
+        
+        chirpRe_.resize(tamano);
+        chirpIm_.resize(tamano);
+        for (int n = 0; n < tamano; n++) {
+            // n² módulo 2N para conservar la precisión del ángulo
+            long long n2 = ((long long)n * n) % (2LL * tamano);
+            double angulo = -PI * n2 / tamano;
+            chirpRe_[n] = (T)std::cos(angulo);
+            chirpIm_[n] = (T)std::sin(angulo);
+        }
+        
+        // Filtro conj(chirp) simétrico y circular, transformado una sola vez.
+        // Incluye el factor 1/M de la transformada inversa.
+        filtroRe_.assign(M, T(0));
+        filtroIm_.assign(M, T(0));
+        T escala = T(1.0 / M);
+        for (int n = 0; n < tamano; n++) {
+            filtroRe_[n] = chirpRe_[n] * escala;
+            filtroIm_[n] = -chirpIm_[n] * escala;
+            if (n > 0) {
+                filtroRe_[M - n] = filtroRe_[n];
+                filtroIm_[M - n] = filtroIm_[n];
+            }
+        }
+        planInterno_->ejecutar(filtroRe_.data(), filtroIm_.data());
+        
+        convolucionRe_.resize(M);
+        convolucionIm_.resize(M);
+    }
+    
+    trabajoRe_.resize(tamano);
+    trabajoIm_.resize(tamano);
+}
+
+template <typename T>
+void PlanFFT<T>::ejecutar(NumeroComplejo<T>* datos) const {
+    // Aplicar la permutación de entrada al pasar de AoS a SoA
+    for (int i = 0; i < tamano_; i++) {
+        const NumeroComplejo<T>& origen = datos[permutacion_[i]];
+        trabajoRe_[i] = origen.real;
+        trabajoIm_[i] = origen.imaginario;
+    }
+    
+    ejecutarEtapas(trabajoRe_.data(), trabajoIm_.data());
+    
+    for (int i = 0; i < tamano_; i++) {
+        datos[i] = NumeroComplejo<T>(trabajoRe_[i], trabajoIm_[i]);
+    }
+}
+
+template <typename T>
+void PlanFFT<T>::ejecutar(std::vector<NumeroComplejo<T>>& datos) const {
+    if ((int)datos.size() != tamano_) {
+        throw std::invalid_argument("El tamaño de los datos no coincide con el plan de FFT");
+    }
+    ejecutar(datos.data());
+}
+
+template <typename T>
+void PlanFFT<T>::ejecutar(T* re, T* im) const {
+    if (algoritmo_ == Algoritmo::Radix2) {
+        // La inversión de bits es una involución: cada par se intercambia una sola vez
+        for (int i = 0; i < tamano_; i++) {
+            int j = permutacion_[i];
+            if (i < j) {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+    } else if (algoritmo_ == Algoritmo::RadixMixto) {
+        for (int i = 0; i < tamano_; i++) {
+            trabajoRe_[i] = re[permutacion_[i]];
+            trabajoIm_[i] = im[permutacion_[i]];
+        }
+        std::copy(trabajoRe_.begin(), trabajoRe_.end(), re);
+        std::copy(trabajoIm_.begin(), trabajoIm_.end(), im);
+    }
+    
+    ejecutarEtapas(re, im);
+}
+
+template <typename T>
+void PlanFFT<T>::ejecutarEtapas(T* re, T* im) const {
+    switch (algoritmo_) {
+        case Algoritmo::Radix2:
+            nucleos_->etapas(re, im, tamano_, giroRe_.data(), giroIm_.data());
+            break;
+        case Algoritmo::RadixMixto:
+            etapasRadixMixto(re, im);
+            break;
+        case Algoritmo::Bluestein:
+            etapasBluestein(re, im);
+            break;
+    }
+}
+
+template <typename T>
+void PlanFFT<T>::etapasRadixMixto(T* re, T* im) const {
+    // Constantes de las DFT de 3 y 5 puntos (sentido directo, e^(-2πi/p))
+    const T s3 = (T)std::sin(2.0 * PI / 3.0);
+    const T c51 = (T)std::cos(2.0 * PI / 5.0);
+    const T c52 = (T)std::cos(4.0 * PI / 5.0);
+    const T s51 = (T)std::sin(2.0 * PI / 5.0);
+    const T s52 = (T)std::sin(4.0 * PI / 5.0);
+    
+    int m = 1;
+    const T* wRe = giroRe_.data();
+    const T* wIm = giroIm_.data();
+    
+    for (int p : radices_) {
+        int longitud = p * m;
+        
+        for (int inicio = 0; inicio < tamano_; inicio += longitud) {
+            for (int k = 0; k < m; k++) {
+                int base = inicio + k;
+                
+                // Cargar las p entradas aplicando los factores de giro
+                T xr[5], xi[5];
+                xr[0] = re[base];
+                xi[0] = im[base];
+                for (int q = 1; q < p; q++) {
+                    T ar = re[base + q * m];
+                    T ai = im[base + q * m];
+                    T wr = wRe[k * (p - 1) + q - 1];
+                    T wi = wIm[k * (p - 1) + q - 1];
+                    xr[q] = ar * wr - ai * wi;
+                    xi[q] = ar * wi + ai * wr;
+                }
+                
+                // DFT de p puntos; -i·(a + ib) = b - ia
+                switch (p) {
+                    case 2: {
+                        re[base] = xr[0] + xr[1];
+                        im[base] = xi[0] + xi[1];
+                        re[base + m] = xr[0] - xr[1];
+                        im[base + m] = xi[0] - xi[1];
+                        break;
+                    }
+                    case 3: {
+                        T sumaRe = xr[1] + xr[2];
+                        T sumaIm = xi[1] + xi[2];
+                        T medioRe = xr[0] - T(0.5) * sumaRe;
+                        T medioIm = xi[0] - T(0.5) * sumaIm;
+                        T rotRe = s3 * (xi[1] - xi[2]);
+                        T rotIm = -s3 * (xr[1] - xr[2]);
+                        re[base] = xr[0] + sumaRe;
+                        im[base] = xi[0] + sumaIm;
+                        re[base + m] = medioRe + rotRe;
+                        im[base + m] = medioIm + rotIm;
+                        re[base + 2 * m] = medioRe - rotRe;
+                        im[base + 2 * m] = medioIm - rotIm;
+                        break;
+                    }
+                    case 4: {
+                        T aRe = xr[0] + xr[2], aIm = xi[0] + xi[2];
+                        T bRe = xr[0] - xr[2], bIm = xi[0] - xi[2];
+                        T cRe = xr[1] + xr[3], cIm = xi[1] + xi[3];
+                        T dRe = xi[1] - xi[3], dIm = -(xr[1] - xr[3]);
+                        re[base] = aRe + cRe;
+                        im[base] = aIm + cIm;
+                        re[base + m] = bRe + dRe;
+                        im[base + m] = bIm + dIm;
+                        re[base + 2 * m] = aRe - cRe;
+                        im[base + 2 * m] = aIm - cIm;
+                        re[base + 3 * m] = bRe - dRe;
+                        im[base + 3 * m] = bIm - dIm;
+                        break;
+                    }
+                    case 5: {
+                        T a1Re = xr[1] + xr[4], a1Im = xi[1] + xi[4];
+                        T a2Re = xr[2] + xr[3], a2Im = xi[2] + xi[3];
+                        T b1Re = xr[1] - xr[4], b1Im = xi[1] - xi[4];
+                        T b2Re = xr[2] - xr[3], b2Im = xi[2] - xi[3];
+                        
+                        T r1Re = xr[0] + c51 * a1Re + c52 * a2Re;
+                        T r1Im = xi[0] + c51 * a1Im + c52 * a2Im;
+                        T r2Re = xr[0] + c52 * a1Re + c51 * a2Re;
+                        T r2Im = xi[0] + c52 * a1Im + c51 * a2Im;
+                        
+                        // -i·(s51·b1 + s52·b2) y -i·(s52·b1 - s51·b2)
+                        T i1Re = s51 * b1Im + s52 * b2Im;
+                        T i1Im = -(s51 * b1Re + s52 * b2Re);
+                        T i2Re = s52 * b1Im - s51 * b2Im;
+                        T i2Im = -(s52 * b1Re - s51 * b2Re);
+                        
+                        re[base] = xr[0] + a1Re + a2Re;
+                        im[base] = xi[0] + a1Im + a2Im;
+                        re[base + m] = r1Re + i1Re;
+                        im[base + m] = r1Im + i1Im;
+                        re[base + 2 * m] = r2Re + i2Re;
+                        im[base + 2 * m] = r2Im + i2Im;
+                        re[base + 3 * m] = r2Re - i2Re;
+                        im[base + 3 * m] = r2Im - i2Im;
+                        re[base + 4 * m] = r1Re - i1Re;
+                        im[base + 4 * m] = r1Im - i1Im;
+                        break;
+                    }
+                }
+            }
+        }
+        
+        wRe += (size_t)m * (p - 1);
+        wIm += (size_t)m * (p - 1);
+        m = longitud;
+    }
+}
+
+template <typename T>
+void PlanFFT<T>::etapasBluestein(T* re, T* im) const {
+    const int M = planInterno_->tamano();
+    T* aRe = convolucionRe_.data();
+    T* aIm = convolucionIm_.data();
+    
+    // a[n] = x[n]·chirp[n], completado con ceros hasta M
+    for (int n = 0; n < tamano_; n++) {
+        aRe[n] = re[n] * chirpRe_[n] - im[n] * chirpIm_[n];
+        aIm[n] = re[n] * chirpIm_[n] + im[n] * chirpRe_[n];
+    }
+    std::fill(aRe + tamano_, aRe + M, T(0));
+    std::fill(aIm + tamano_, aIm + M, T(0));
+    
+    planInterno_->ejecutar(aRe, aIm);
+    
+    // Producto con el filtro y conjugado, para obtener la inversa con una FFT directa
+    for (int k = 0; k < M; k++) {
+        T pr = aRe[k] * filtroRe_[k] - aIm[k] * filtroIm_[k];
+        T pi = aRe[k] * filtroIm_[k] + aIm[k] * filtroRe_[k];
+        aRe[k] = pr;
+        aIm[k] = -pi;
+    }
+    
+    planInterno_->ejecutar(aRe, aIm);
+    
+    // X[k] = chirp[k]·conj(resultado[k])
+    for (int k = 0; k < tamano_; k++) {
+        T cr = aRe[k];
+        T ci = -aIm[k];
+        re[k] = cr * chirpRe_[k] - ci * chirpIm_[k];
+        im[k] = cr * chirpIm_[k] + ci * chirpRe_[k];
+    }
+}
+
+template <typename T>
+void PlanFFT<T>::ejecutarLote(NumeroComplejo<T>* tramas, int cantidad) const {
+    const int N = tamano_;
+    const int B = anchoLote;
+    
+    // Sólo radix 2 tiene etapas por lotes; en los demás algoritmos entrelazar
+    // las tramas no ahorra nada y cuesta dos copias, así que van una a una
+    if (algoritmo_ != Algoritmo::Radix2) {
+        for (int f = 0; f < cantidad; f++) {
+            ejecutar(tramas + (size_t)f * N);
+        }
+        return;
+    }
+    
+    if (loteRe_.empty()) {
+        loteRe_.resize((size_t)N * B);
+        loteIm_.resize((size_t)N * B);
+    }
+    T* re = loteRe_.data();
+    T* im = loteIm_.data();
+    
+    for (int primera = 0; primera < cantidad; primera += B) {
+        int enBloque = std::min(B, cantidad - primera);
+        NumeroComplejo<T>* bloque = tramas + (size_t)primera * N;
+        
+        // Entrelazar las tramas aplicando la permutación de entrada; los
+        // carriles sobrantes del último bloque se rellenan con ceros
+        for (int i = 0; i < N; i++) {
+            const NumeroComplejo<T>* origen = bloque + permutacion_[i];
+            T* destinoRe = re + (size_t)i * B;
+            T* destinoIm = im + (size_t)i * B;
+            for (int f = 0; f < enBloque; f++) {
+                destinoRe[f] = origen[(size_t)f * N].real;
+                destinoIm[f] = origen[(size_t)f * N].imaginario;
+            }
+            for (int f = enBloque; f < B; f++) {
+                destinoRe[f] = T(0);
+                destinoIm[f] = T(0);
+            }
+        }
+        
+        ejecutarEtapasLote(re, im);
+        
+        for (int f = 0; f < enBloque; f++) {
+            NumeroComplejo<T>* trama = bloque + (size_t)f * N;
+            for (int i = 0; i < N; i++) {
+                trama[i] = NumeroComplejo<T>(re[(size_t)i * B + f], im[(size_t)i * B + f]);
+            }
+        }
+    }
+}
+
+template <typename T>
+void PlanFFT<T>::ejecutarEtapasLote(T* re, T* im) const {
+    if (algoritmo_ == Algoritmo::Radix2) {
+        nucleos_->etapasLote(re, im, tamano_, anchoLote, giroRe_.data(), giroIm_.data());
+        return;
+    }
+    
+    // Radix mixto y Bluestein: transformar cada trama por separado (ejecutarLote
+    // no llega aquí con estos algoritmos; sólo quien llame directamente)
+    for (int f = 0; f < anchoLote; f++) {
+        for (int i = 0; i < tamano_; i++) {
+            trabajoRe_[i] = re[(size_t)i * anchoLote + f];
+            trabajoIm_[i] = im[(size_t)i * anchoLote + f];
+        }
+        ejecutarEtapas(trabajoRe_.data(), trabajoIm_.data());
+        for (int i = 0; i < tamano_; i++) {
+            re[(size_t)i * anchoLote + f] = trabajoRe_[i];
+            im[(size_t)i * anchoLote + f] = trabajoIm_[i];
+        }
+    }
+}
+
+// Instancias usadas por el proyecto
+template class PlanFFT<float>;
+template class PlanFFT<double>;
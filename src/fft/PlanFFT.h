@@ -0,0 +1,91 @@
+#ifndef PLAN_FFT_H
+#define PLAN_FFT_H
+
+#include <memory>
+#include <vector>
+#include "NucleosFFT.h"
+#include "../utilidades/NumeroComplejo.h"
+
+// Plan de FFT para un tamaño fijo. Los factores de giro y la permutación de
+// entrada se calculan una sola vez en el constructor. Internamente trabaja en
+// formato SoA (partes real e imaginaria separadas). Según el tamaño usa:
+//   - Radix 2 (potencias de 2) con los núcleos SIMD de NucleosFFT
+//   - Radix mixto 2/3/4/5 (tamaños de la forma 2^a·3^b·5^c, p. ej. 960 o 1200)
+//   - Bluestein (cualquier otro tamaño) sobre una FFT radix 2 interna
+// Un mismo plan no debe ejecutarse desde varios hilos a la vez.
+// T es el tipo escalar (float o double).
+template <typename T>
+class PlanFFT {
+public:
+    enum class Algoritmo { Radix2, RadixMixto, Bluestein };
+    
+    // Construir el plan para cualquier tamaño positivo. Si no se indican
+    // núcleos se usan los mejores que soporte la CPU.
+    explicit PlanFFT(int tamano, const NucleosFFT::Tabla* nucleos = nullptr);
+    
+    // Ejecutar la FFT in-place sobre 'tamano' elementos
+    void ejecutar(NumeroComplejo<T>* datos) const;
+    void ejecutar(std::vector<NumeroComplejo<T>>& datos) const;
+    
+    // Ejecutar la FFT in-place sobre datos SoA
+    void ejecutar(T* re, T* im) const;
+    
+    // Ejecutar sólo las etapas sobre datos SoA ya reordenados según permutacion()
+    void ejecutarEtapas(T* re, T* im) const;
+    
+    // Número de tramas que se transforman juntas en un lote (una línea de
+    // caché de 64 bytes por elemento y componente)
+    static constexpr int anchoLote = 64 / sizeof(T);
+    
+    // Ejecutar la FFT in-place sobre 'cantidad' tramas contiguas de 'tamano'
+    // elementos. En radix 2 las tramas se procesan en bloques de anchoLote
+    // entrelazadas, compartiendo factores de giro y carriles SIMD entre tramas;
+    // con radix mixto o Bluestein se transforman una a una.
+    void ejecutarLote(NumeroComplejo<T>* tramas, int cantidad) const;
+    
+    // Ejecutar sólo las etapas sobre anchoLote tramas SoA entrelazadas (el
+    // elemento i de la trama f en i * anchoLote + f) ya reordenadas según permutacion()
+    void ejecutarEtapasLote(T* re, T* im) const;
+    
+    // Tamaño de la transformada
+    int tamano() const { return tamano_; }
+    
+    // Algoritmo elegido para este tamaño
+    Algoritmo algoritmo() const { return algoritmo_; }
+    
+    // Índice de origen de cada posición antes de las etapas (inversión de
+    // bits en radix 2, inversión de dígitos en radix mixto, identidad en Bluestein)
+    const std::vector<int>& permutacion() const { return permutacion_; }
+    
+    // Núcleos usados por el plan
+    const NucleosFFT::Tabla& nucleos() const { return *nucleos_; }
+    
+private:
+    // Etapas de radix mixto y algoritmo de Bluestein (escalares)
+    void etapasRadixMixto(T* re, T* im) const;
+    void etapasBluestein(T* re, T* im) const;
+    
+    int tamano_;
+    Algoritmo algoritmo_;
+    const NucleosFFT::Tabla* nucleos_;
+    std::vector<int> permutacion_;
+    std::vector<int> radices_;           // Radix de cada etapa (radix mixto)
+    std::vector<T> giroRe_;              // Factores de giro por etapa. Radix 2: la etapa
+    std::vector<T> giroIm_;              // con mitad m ocupa [m - 1, 2m - 1)
+    
+    // Bluestein: chirp e^(-iπn²/N), filtro transformado y FFT radix 2 interna
+    std::unique_ptr<PlanFFT<T>> planInterno_;
+    std::vector<T> chirpRe_;
+    std::vector<T> chirpIm_;
+    std::vector<T> filtroRe_;
+    std::vector<T> filtroIm_;
+    mutable std::vector<T> convolucionRe_;
+    mutable std::vector<T> convolucionIm_;
+    
+    mutable std::vector<T> trabajoRe_;   // Búfer SoA para la interfaz AoS
+    mutable std::vector<T> trabajoIm_;
+    mutable std::vector<T> loteRe_;      // Búfer entrelazado para ejecutarLote
+    mutable std::vector<T> loteIm_;      // (se reserva en el primer uso)
+};
+
+#endif
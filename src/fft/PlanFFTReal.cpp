@@ -0,0 +1,260 @@
+#include "PlanFFTReal.h"
+#include "FFT.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+const double PI = 3.14159265358979323846;
+
+// Tamaño de la FFT compleja subyacente: N/2 si N es par, N si es impar
+int tamanoComplejo(int tamano) {
+    if (tamano < 1) {
+        throw std::invalid_argument("El tamaño de la FFT real debe ser positivo");
+    }
+    return tamano % 2 == 0 ? tamano / 2 : tamano;
+}
+}
+
+template <typename T>
+PlanFFTReal<T>::PlanFFTReal(int tamano, const NucleosFFT::Tabla* nucleos)
+    : tamano_(tamano), planComplejo_(tamanoComplejo(tamano), nucleos) {
+    factoresGiro_.resize(tamano / 4 + 1);
+    for (int k = 0; k <= tamano / 4; k++) {
+        double angulo = -2.0 * PI * k / tamano;
+        factoresGiro_[k] = NumeroComplejo<T>((T)std::cos(angulo), (T)std::sin(angulo));
+    }
+    
+    trabajoRe_.resize(planComplejo_.tamano());
+    trabajoIm_.resize(planComplejo_.tamano());
+}
+
+template <typename T>
+void PlanFFTReal<T>::ejecutar(const T* entrada, NumeroComplejo<T>* salida) const {
+    T* re = trabajoRe_.data();
+    T* im = trabajoIm_.data();
+    const std::vector<int>& permutacion = planComplejo_.permutacion();
+    
+    if (tamano_ % 2 != 0) {
+        // Tamaño impar: FFT compleja completa con parte imaginaria nula
+        for (int i = 0; i < tamano_; i++) {
+            re[i] = entrada[permutacion[i]];
+            im[i] = T(0);
+        }
+        planComplejo_.ejecutarEtapas(re, im);
+        copiarBins(re, im, 1, 1, salida);
+        return;
+    }
+    
+    // Empaquetar z[n] = x[2n] + i·x[2n+1] directamente en el orden de la permutación de entrada
+    int M = tamano_ / 2;
+    for (int i = 0; i < M; i++) {
+        int n = permutacion[i];
+        re[i] = entrada[2 * n];
+        im[i] = entrada[2 * n + 1];
+    }
+    
+    planComplejo_.ejecutarEtapas(re, im);
+    separarEspectros(re, im, 1, 1, salida);
+}
+
+template <typename T>
+void PlanFFTReal<T>::ejecutar(const std::vector<T>& entrada, std::vector<NumeroComplejo<T>>& salida) const {
+    if ((int)entrada.size() != tamano_) {
+        throw std::invalid_argument("El tamaño de los datos no coincide con el plan de FFT real");
+    }
+    salida.resize(numBins());
+    ejecutar(entrada.data(), salida.data());
+}
+
+template <typename T>
+void PlanFFTReal<T>::ejecutarInversa(const NumeroComplejo<T>* espectro, T* salida) const {
+    T* re = trabajoRe_.data();
+    T* im = trabajoIm_.data();
+    
+    if (tamano_ % 2 != 0) {
+        // Tamaño impar: reconstruir el espectro completo (X[N-k] = conj(X[k]))
+        // e invertir con la FFT compleja de N puntos conjugando entrada y salida
+        for (int k = 0; k < tamano_; k++) {
+            int origen = k < numBins() ? k : tamano_ - k;
+            T signo = k < numBins() ? T(-1) : T(1);
+            re[k] = espectro[origen].real;
+            im[k] = signo * espectro[origen].imaginario;
+        }
+        planComplejo_.ejecutar(re, im);
+        T escala = T(1) / tamano_;
+        for (int n = 0; n < tamano_; n++) {
+            salida[n] = re[n] * escala;
+        }
+        return;
+    }
+    
+    // Recombinar los espectros par (Fe) e impar (Fo) en Z[k] = Fe[k] + i·Fo[k]:
+    //   Fe[k] = (X[k] + conj(X[M-k])) / 2
+    //   Fo[k] = (X[k] - conj(X[M-k])) · conj(W^k) / 2
+    // con W^k = -conj(W^(M-k)) para k > M/2. Se guarda conj(Z) para obtener
+    // la inversa con la FFT directa.
+    const int M = tamano_ / 2;
+    for (int k = 0; k < M; k++) {
+        const NumeroComplejo<T>& a = espectro[k];
+        const NumeroComplejo<T>& b = espectro[M - k];
+        
+        T wRe, wIm;
+        if (k <= M / 2) {
+            wRe = factoresGiro_[k].real;
+            wIm = factoresGiro_[k].imaginario;
+        } else {
+            wRe = -factoresGiro_[M - k].real;
+            wIm = factoresGiro_[M - k].imaginario;
+        }
+        
+        T feRe = T(0.5) * (a.real + b.real);
+        T feIm = T(0.5) * (a.imaginario - b.imaginario);
+        T dRe = T(0.5) * (a.real - b.real);
+        T dIm = T(0.5) * (a.imaginario + b.imaginario);
+        
+        // Fo = d · conj(W^k)
+        T foRe = dRe * wRe + dIm * wIm;
+        T foIm = dIm * wRe - dRe * wIm;
+        
+        // conj(Fe + i·Fo)
+        re[k] = feRe - foIm;
+        im[k] = -(feIm + foRe);
+    }
+    
+    planComplejo_.ejecutar(re, im);
+    
+    // z[n] = conj(resultado) / M, con x[2n] = Re z[n] y x[2n+1] = Im z[n]
+    T escala = T(1) / M;
+    for (int n = 0; n < M; n++) {
+        salida[2 * n] = re[n] * escala;
+        salida[2 * n + 1] = -im[n] * escala;
+    }
+}
+
+template <typename T>
+void PlanFFTReal<T>::ejecutarInversa(const std::vector<NumeroComplejo<T>>& espectro, std::vector<T>& salida) const {
+    if ((int)espectro.size() != numBins()) {
+        throw std::invalid_argument("El número de bins no coincide con el plan de FFT real");
+    }
+    salida.resize(tamano_);
+    ejecutarInversa(espectro.data(), salida.data());
+}
+
+template <typename T>
+void PlanFFTReal<T>::ejecutarLote(const T* entrada, int cantidad, NumeroComplejo<T>* salida) const {
+    const int M = planComplejo_.tamano();
+    const int B = PlanFFT<T>::anchoLote;
+    const bool impar = tamano_ % 2 != 0;
+    
+    // Sin etapas por lotes (radix mixto, Bluestein) cada trama se transforma
+    // por separado: entrelazarlas sólo añadiría copias y carriles vacíos
+    if (planComplejo_.algoritmo() != PlanFFT<T>::Algoritmo::Radix2) {
+        for (int f = 0; f < cantidad; f++) {
+            ejecutar(entrada + (size_t)f * tamano_, salida + (size_t)f * numBins());
+        }
+        return;
+    }
+    
+    if (loteRe_.empty()) {
+        loteRe_.resize((size_t)M * B);
+        loteIm_.resize((size_t)M * B);
+    }
+    T* re = loteRe_.data();
+    T* im = loteIm_.data();
+    
+    const std::vector<int>& permutacion = planComplejo_.permutacion();
+    for (int primera = 0; primera < cantidad; primera += B) {
+        int enBloque = std::min(B, cantidad - primera);
+        const T* bloque = entrada + (size_t)primera * tamano_;
+        
+        // Empaquetar y entrelazar las tramas en el orden de la permutación de
+        // entrada (con tamaño impar cada muestra real ocupa un elemento complejo)
+        for (int i = 0; i < M; i++) {
+            const T* origen = bloque + (impar ? permutacion[i] : 2 * permutacion[i]);
+            T* destinoRe = re + (size_t)i * B;
+            T* destinoIm = im + (size_t)i * B;
+            for (int f = 0; f < enBloque; f++) {
+                destinoRe[f] = origen[(size_t)f * tamano_];
+                destinoIm[f] = impar ? T(0) : origen[(size_t)f * tamano_ + 1];
+            }
+            for (int f = enBloque; f < B; f++) {
+                destinoRe[f] = T(0);
+                destinoIm[f] = T(0);
+            }
+        }
+        
+        planComplejo_.ejecutarEtapasLote(re, im);
+        
+        NumeroComplejo<T>* destino = salida + (size_t)primera * numBins();
+        if (impar) {
+            copiarBins(re, im, B, enBloque, destino);
+        } else {
+            separarEspectros(re, im, B, enBloque, destino);
+        }
+    }
+}
+
+template <typename T>
+void PlanFFTReal<T>::separarEspectros(const T* re, const T* im, int paso, int cantidad,
+                                      NumeroComplejo<T>* salida) const {
+    const int M = tamano_ / 2;
+    const int bins = numBins();
+    
+    // Bins extremos (DC y Nyquist) son reales
+    for (int f = 0; f < cantidad; f++) {
+        NumeroComplejo<T>* X = salida + (size_t)f * bins;
+        X[0].real = re[f] + im[f];
+        X[0].imaginario = T(0);
+        X[M].real = re[f] - im[f];
+        X[M].imaginario = T(0);
+    }
+    
+    // Separar espectros par (Fe) e impar (Fo) procesando k y M-k a la vez:
+    //   Fe[k] = (Z[k] + conj(Z[M-k])) / 2
+    //   Fo[k] = -i·(Z[k] - conj(Z[M-k])) / 2
+    //   X[k]   = Fe[k] + W^k · Fo[k]
+    //   X[M-k] = conj(Fe[k]) + W^(M-k) · conj(Fo[k]) = conj(Fe[k] - W^k · Fo[k])
+    for (int k = 1; k <= M / 2; k++) {
+        const T* zkRe = re + (size_t)k * paso;
+        const T* zkIm = im + (size_t)k * paso;
+        const T* zmRe = re + (size_t)(M - k) * paso;
+        const T* zmIm = im + (size_t)(M - k) * paso;
+        T wRe = factoresGiro_[k].real;
+        T wIm = factoresGiro_[k].imaginario;
+        
+        for (int f = 0; f < cantidad; f++) {
+            T feRe = T(0.5) * (zkRe[f] + zmRe[f]);
+            T feIm = T(0.5) * (zkIm[f] - zmIm[f]);
+            T foRe = T(0.5) * (zkIm[f] + zmIm[f]);
+            T foIm = -T(0.5) * (zkRe[f] - zmRe[f]);
+            
+            // t = W^k · Fo[k]
+            T tRe = wRe * foRe - wIm * foIm;
+            T tIm = wRe * foIm + wIm * foRe;
+            
+            NumeroComplejo<T>* X = salida + (size_t)f * bins;
+            X[k].real = feRe + tRe;
+            X[k].imaginario = feIm + tIm;
+            X[M - k].real = feRe - tRe;
+            X[M - k].imaginario = tIm - feIm;
+        }
+    }
+}
+
+template <typename T>
+void PlanFFTReal<T>::copiarBins(const T* re, const T* im, int paso, int cantidad,
+                               NumeroComplejo<T>* salida) const {
+    const int bins = numBins();
+    for (int k = 0; k < bins; k++) {
+        for (int f = 0; f < cantidad; f++) {
+            NumeroComplejo<T>& X = salida[(size_t)f * bins + k];
+            X.real = re[(size_t)k * paso + f];
+            X.imaginario = im[(size_t)k * paso + f];
+        }
+    }
+}
+
+// Instancias usadas por el proyecto
+template class PlanFFTReal<float>;
+template class PlanFFTReal<double>;
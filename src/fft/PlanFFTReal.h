@@ -0,0 +1,62 @@
+#ifndef PLAN_FFT_REAL_H
+#define PLAN_FFT_REAL_H
+
+#include <vector>
+#include "PlanFFT.h"
+#include "../utilidades/NumeroComplejo.h"
+
+// Plan de FFT para entrada real. Las N muestras reales se empaquetan como
+// N/2 números complejos (pares en la parte real, impares en la imaginaria),
+// se transforman con una FFT compleja de tamaño N/2 y un paso posterior
+// separa los dos espectros. Con N impar se usa una FFT compleja de tamaño N.
+// Sólo se devuelven los N/2 + 1 bins no redundantes.
+// T es el tipo escalar (float o double).
+template <typename T>
+class PlanFFTReal {
+public:
+    // Construir el plan para cualquier tamaño positivo
+    explicit PlanFFTReal(int tamano, const NucleosFFT::Tabla* nucleos = nullptr);
+    
+    // Transformar 'tamano' muestras reales en numBins() bins complejos.
+    // 'salida' debe tener espacio para numBins() elementos; no se reserva memoria.
+    void ejecutar(const T* entrada, NumeroComplejo<T>* salida) const;
+    void ejecutar(const std::vector<T>& entrada, std::vector<NumeroComplejo<T>>& salida) const;
+    
+    // Transformada inversa: reconstruir 'tamano' muestras reales a partir de
+    // numBins() bins (el espectro se supone hermítico). Incluye el factor 1/N.
+    void ejecutarInversa(const NumeroComplejo<T>* espectro, T* salida) const;
+    void ejecutarInversa(const std::vector<NumeroComplejo<T>>& espectro, std::vector<T>& salida) const;
+    
+    // Transformar 'cantidad' tramas reales contiguas de 'tamano' muestras usando
+    // la FFT por lotes (una a una si la FFT compleja no es radix 2).
+    // 'salida' recibe 'cantidad' bloques consecutivos de numBins() bins.
+    void ejecutarLote(const T* entrada, int cantidad, NumeroComplejo<T>* salida) const;
+    
+    // Tamaño de la transformada (número de muestras reales)
+    int tamano() const { return tamano_; }
+    
+    // Número de bins de salida (N/2 + 1, redondeando hacia abajo)
+    int numBins() const { return tamano_ / 2 + 1; }
+    
+private:
+    // Separar los espectros par/impar a partir de la FFT compleja de N/2 puntos
+    // de 'cantidad' tramas (el elemento k de la trama f está en k * paso + f) y
+    // escribir numBins() bins por trama de forma consecutiva en 'salida'
+    void separarEspectros(const T* re, const T* im, int paso, int cantidad,
+                          NumeroComplejo<T>* salida) const;
+    
+    // Tamaño impar: copiar los primeros numBins() bins de la FFT compleja de N
+    // puntos de 'cantidad' tramas (mismo formato que separarEspectros)
+    void copiarBins(const T* re, const T* im, int paso, int cantidad,
+                    NumeroComplejo<T>* salida) const;
+    
+    int tamano_;
+    PlanFFT<T> planComplejo_;                       // FFT compleja de tamaño N/2 (N si es impar)
+    std::vector<NumeroComplejo<T>> factoresGiro_;   // e^(-2πik/N) para k <= N/4
+    mutable std::vector<T> trabajoRe_;              // Datos empaquetados en SoA
+    mutable std::vector<T> trabajoIm_;
+    mutable std::vector<T> loteRe_;                 // Búfer entrelazado para ejecutarLote
+    mutable std::vector<T> loteIm_;
+};
+
+#endif
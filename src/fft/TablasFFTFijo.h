@@ -0,0 +1,118 @@
+#ifndef TABLAS_FFT_FIJO_H
+#define TABLAS_FFT_FIJO_H
+
+#include <array>
+
+// Cálculos evaluables en tiempo de compilación para las FFT de tamaño fijo
+class CalculoConstexpr {
+public:
+    static constexpr double PI = 3.14159265358979323846;
+    
+    // Seno y coseno: reducción al cuadrante |r| <= π/4 y serie de Taylor
+    static constexpr double seno(double x) {
+        int q = cuadrante(x);
+        double r = x - q * (PI / 2);
+        switch (((q % 4) + 4) % 4) {
+            case 0: return serieSeno(r);
+            case 1: return serieCoseno(r);
+            case 2: return -serieSeno(r);
+            default: return -serieCoseno(r);
+        }
+    }
+    
+    static constexpr double coseno(double x) {
+        int q = cuadrante(x);
+        double r = x - q * (PI / 2);
+        switch (((q % 4) + 4) % 4) {
+            case 0: return serieCoseno(r);
+            case 1: return -serieSeno(r);
+            case 2: return -serieCoseno(r);
+            default: return serieSeno(r);
+        }
+    }
+    
+    // Tabla de inversión de bits para N potencia de 2
+    template <int N>
+    static constexpr std::array<int, N> inversionBits() {
+        std::array<int, N> tabla = {};
+        int numBits = 0;
+        while ((1 << numBits) < N) {
+            numBits++;
+        }
+        for (int i = 0; i < N; i++) {
+            int invertido = 0;
+            for (int b = 0; b < numBits; b++) {
+                if (i & (1 << b)) {
+                    invertido |= 1 << (numBits - 1 - b);
+                }
+            }
+            tabla[i] = invertido;
+        }
+        return tabla;
+    }
+    
+    // Factores de giro por etapa de una FFT radix 2 de N puntos, con la misma
+    // disposición que PlanFFT (la etapa con mitad m ocupa [m - 1, 2m - 1))
+    template <typename T, int N>
+    static constexpr std::array<T, N - 1> girosEtapas(bool parteImaginaria) {
+        std::array<T, N - 1> tabla = {};
+        for (int mitad = 1; mitad < N; mitad *= 2) {
+            for (int k = 0; k < mitad; k++) {
+                double angulo = -PI * k / mitad;
+                tabla[mitad - 1 + k] = (T)(parteImaginaria ? seno(angulo) : coseno(angulo));
+            }
+        }
+        return tabla;
+    }
+    
+    // e^(-πik/N) para k <= N/2: separación de espectros de una FFT real de 2N puntos
+    template <typename T, int N>
+    static constexpr std::array<T, N / 2 + 1> girosSeparacion(bool parteImaginaria) {
+        std::array<T, N / 2 + 1> tabla = {};
+        for (int k = 0; k <= N / 2; k++) {
+            double angulo = -PI * k / N;
+            tabla[k] = (T)(parteImaginaria ? seno(angulo) : coseno(angulo));
+        }
+        return tabla;
+    }
+    
+private:
+    static constexpr int cuadrante(double x) {
+        double q = x / (PI / 2);
+        return (int)(q >= 0 ? q + 0.5 : q - 0.5);
+    }
+    
+    static constexpr double serieSeno(double r) {
+        double termino = r;
+        double suma = r;
+        for (int n = 1; n < 12; n++) {
+            termino *= -r * r / ((2 * n) * (2 * n + 1));
+            suma += termino;
+        }
+        return suma;
+    }
+    
+    static constexpr double serieCoseno(double r) {
+        double termino = 1.0;
+        double suma = 1.0;
+        for (int n = 1; n < 12; n++) {
+            termino *= -r * r / ((2 * n - 1) * (2 * n));
+            suma += termino;
+        }
+        return suma;
+    }
+};
+
+// Tablas constantes de una FFT compleja de N puntos (N potencia de 2),
+// calculadas por el compilador y compartidas por todas las unidades de traducción
+template <typename T, int N>
+class TablasFFTFijo {
+public:
+    static constexpr std::array<int, N> inversionBits = CalculoConstexpr::inversionBits<N>();
+    static constexpr std::array<T, N - 1> giroRe = CalculoConstexpr::girosEtapas<T, N>(false);
+    static constexpr std::array<T, N - 1> giroIm = CalculoConstexpr::girosEtapas<T, N>(true);
+    static constexpr std::array<T, N / 2 + 1> separacionRe = CalculoConstexpr::girosSeparacion<T, N>(false);
+    static constexpr std::array<T, N / 2 + 1> separacionIm = CalculoConstexpr::girosSeparacion<T, N>(true);
+};
+
+#endif
@@ -8,9 +8,13 @@
 #include <string>
 #include <filesystem>
 #include <chrono>
+#include <memory>
+#include <stdexcept>
 #include "audio/LectorAudio.h"
+#include "audio/FuenteAudio.h"
 #include "fft/FFT.h"
 #include "procesamiento/Espectrograma.h"
+#include "procesamiento/FiltroFIR.h"
 #include "procesamiento/DetectorPicos.h"
 #include "procesamiento/GeneradorHashes.h"
 #include "indexacion/BaseDatosHashes.h"
@@ -24,14 +28,25 @@ namespace fs = std::filesystem;
 
 // MODO 1: DEMO COMPLETO (Fases 1-5)
 
-int modoDemo(const std::string& nombreArchivo) {
+// formatoSalida: "csv", "npy" o "crudo" (matrices float32 para el espectrograma,
+// las bandas y los picos; la constelación y los fingerprints siempre son texto)
+int modoDemo(const std::string& nombreArchivo, const std::string& formatoSalida) {
+    if (formatoSalida != "csv" && formatoSalida != "npy" && formatoSalida != "crudo") {
+        std::cerr << "Formato de salida desconocido: " << formatoSalida << " (csv, npy o crudo)" << std::endl;
+        return 1;
+    }
+    bool binario = formatoSalida != "csv";
+    FormatoBinario formato = formatoSalida == "crudo" ? FormatoBinario::Crudo : FormatoBinario::NPY;
+    std::string extension = !binario ? ".csv" : formato == FormatoBinario::NPY ? ".npy" : ".bin";
+    
     try {
         std::cout << "=== SISTEMA DE RECONOCIMIENTO DE AUDIO CON FFT ===" << std::endl;
         std::cout << "Archivo: " << nombreArchivo << std::endl << std::endl;
         
         // ========== FASE 1: Lectura de Audio ==========
         std::cout << "=== FASE 1: LECTURA DE AUDIO ===" << std::endl;
-        DatosAudio audio = LectorAudio::leerWAV(nombreArchivo);
+        DatosAudio audio = LectorAudio::esFLAC(nombreArchivo) ? LectorAudio::leerFLAC(nombreArchivo)
+                                                              : LectorAudio::leerWAV(nombreArchivo);
         LectorAudio::mostrarInfoAudio(audio);
         
         // Encontrar inicio del audio (saltar silencio)
@@ -59,20 +74,32 @@ int modoDemo(const std::string& nombreArchivo) {
         config.inicioAudio = inicioAudio;
         config.aplicarHamming = true;
         
-        Espectrograma::Resultado espectrograma = Espectrograma::calcular(audio, config);
+        // Bandas para la Fase 3: se acumulan dentro de la STFT
+        std::vector<std::pair<double, double>> bandas = {
+            {30, 40}, {40, 80}, {80, 120}, {120, 180}, {180, 300}
+        };
+        config.bandas = bandas;
+        
+        // Modo de análisis: espectrograma en doble precisión
+        Espectrograma::Resultado<double> espectrograma = Espectrograma::calcular<double>(audio, config);
         
         // Exportar espectrograma completo
-        Espectrograma::exportarCSV(espectrograma, "espectrograma.csv");
+        if (binario) {
+            Espectrograma::exportarBinario(espectrograma, "espectrograma" + extension, formato);
+        } else {
+            Espectrograma::exportarCSV(espectrograma, "espectrograma.csv");
+        }
         
         // ========== PREPARACIÓN PARA FASE 3: Dividir en Bandas ==========
         std::cout << "\n=== PREPARACIÓN PARA FASE 3: BANDAS DE FRECUENCIA ===" << std::endl;
         
-        std::vector<std::pair<double, double>> bandas = {
-            {30, 40}, {40, 80}, {80, 120}, {120, 180}, {180, 300}
-        };
-        
         auto bandasEspectrograma = Espectrograma::dividirEnBandas(espectrograma, bandas);
-        Espectrograma::exportarBandasCSV(bandasEspectrograma, bandas, "bandas_frecuencia.csv");
+        if (binario) {
+            Espectrograma::exportarBandasBinario(bandasEspectrograma, espectrograma.resolucionTemporal,
+                                                 "bandas_frecuencia" + extension, formato);
+        } else {
+            Espectrograma::exportarBandasCSV(bandasEspectrograma, bandas, "bandas_frecuencia.csv");
+        }
         
         // ========== FASE 4: Detección de Picos ==========
         std::cout << "\n=== FASE 4: DETECCIÓN DE PICOS ESPECTRALES ===" << std::endl;
@@ -85,13 +112,21 @@ int modoDemo(const std::string& nombreArchivo) {
         configPicos.percentilUmbral = 75.0;
         
         auto picosCompletos = DetectorPicos::detectarPicos(espectrograma, configPicos);
-        DetectorPicos::exportarCSV(picosCompletos, "picos_completos.csv");
+        if (binario) {
+            DetectorPicos::exportarBinario(picosCompletos, "picos_completos" + extension, formato);
+        } else {
+            DetectorPicos::exportarCSV(picosCompletos, "picos_completos.csv");
+        }
         DetectorPicos::exportarConstelacion(picosCompletos, "constelacion.txt");
         
         auto picosBandas = DetectorPicos::detectarPicosEnBandas(
             bandasEspectrograma, bandas, espectrograma.resolucionTemporal, configPicos
         );
-        DetectorPicos::exportarCSV(picosBandas, "picos_bandas.csv");
+        if (binario) {
+            DetectorPicos::exportarBinario(picosBandas, "picos_bandas" + extension, formato);
+        } else {
+            DetectorPicos::exportarCSV(picosBandas, "picos_bandas.csv");
+        }
         
         auto picosFiltrados = DetectorPicos::filtrarPicos(
             picosCompletos.picos, 0.15, 100.0, 5000.0
@@ -131,9 +166,9 @@ int modoDemo(const std::string& nombreArchivo) {
         std::cout << "[ OK ] Fase 5: " << resultadoHashes.totalHashesGenerados << " fingerprints generados" << std::endl;
         
         std::cout << "\nArchivos de salida generados:" << std::endl;
-        std::cout << "  1. espectrograma.csv" << std::endl;
-        std::cout << "  2. bandas_frecuencia.csv" << std::endl;
-        std::cout << "  3. picos_completos.csv" << std::endl;
+        std::cout << "  1. espectrograma" << extension << std::endl;
+        std::cout << "  2. bandas_frecuencia" << extension << std::endl;
+        std::cout << "  3. picos_completos" << extension << " y picos_bandas" << extension << std::endl;
         std::cout << "  4. constelacion.txt" << std::endl;
         std::cout << "  5. fingerprints.csv" << std::endl;
         std::cout << "=============================================" << std::endl;
@@ -146,9 +181,88 @@ int modoDemo(const std::string& nombreArchivo) {
     return 0;
 }
 
+// Abrir el audio como fuente por bloques (WAV, o FLAC si la extensión es
+// .flac). La ruta "-" lee PCM crudo de 16 bits de la entrada estándar. Con
+// frecuenciaAnalisis > 0 la señal se remuestrea a esa frecuencia por bloques.
+// El prefiltro necesita la señal completa, así que en ese caso se lee entera,
+// se filtra y se entrega desde memoria.
+std::unique_ptr<FuenteAudio> abrirFuente(const std::string& ruta, bool prefiltro, int frecuenciaAnalisis,
+                                         int frecuenciaEntrada = 44100, int canalesEntrada = 2) {
+    std::unique_ptr<FuenteAudio> fuente;
+    if (ruta == "-") {
+        fuente = std::make_unique<FuenteEntradaEstandar>(frecuenciaEntrada, canalesEntrada);
+    } else if (LectorAudio::esFLAC(ruta)) {
+        fuente = std::make_unique<FuenteFLAC>(ruta);
+    } else {
+        fuente = std::make_unique<FuenteWAV>(ruta);
+    }
+    
+    if (frecuenciaAnalisis > 0 && frecuenciaAnalisis != fuente->frecuenciaMuestreo()) {
+        Remuestreador::Configuracion configRemuestreo;
+        configRemuestreo.frecuenciaDestino = frecuenciaAnalisis;
+        auto remuestreada = std::make_unique<FuenteRemuestreada>(std::move(fuente), configRemuestreo);
+        std::cout << "  Remuestreo " << remuestreada->origen().frecuenciaMuestreo() << " Hz -> "
+                  << frecuenciaAnalisis << " Hz (L/M = " << remuestreada->remuestreador().interpolacion()
+                  << "/" << remuestreada->remuestreador().decimacion() << ", "
+                  << remuestreada->remuestreador().coeficientesPorFase() << " coeficientes por fase)" << std::endl;
+        fuente = std::move(remuestreada);
+    }
+    
+    if (prefiltro) {
+        DatosAudio audio = LectorAudio::leerFuente(*fuente);
+        FiltroFIR::aplicar(audio, FiltroFIR::Configuracion());
+        fuente = std::make_unique<FuenteMemoria>(std::move(audio));
+    }
+    
+    return fuente;
+}
+
 // MODO 2: INDEXAR CANCIONES
 
-bool procesarArchivoParaIndexar(const std::string& rutaArchivo, BaseDatosHashes& baseDatos) {
+// Activar la puerta de energía del espectrograma (umbralDB = 0: desactivada)
+void configurarPuertaSilencio(Espectrograma::Configuracion& config, double umbralDB) {
+    if (umbralDB < 0.0) {
+        config.puertaEnergia = true;
+        config.umbralEnergiaDB = umbralDB;
+    }
+}
+
+// Limitar el espectrograma a los bins donde filtrarPicos conserva picos
+// (100-5000 Hz): sólo se calculan, se guardan y se analizan esos bins
+void configurarRangoPicos(Espectrograma::Configuracion& config, bool soloRango) {
+    if (soloRango) {
+        config.frecuenciaMinima = 100.0;
+        config.frecuenciaMaxima = 5000.0;
+    }
+}
+
+// Interpretar el argumento de --banco (mel o log)
+Espectrograma::TipoBanco leerTipoBanco(const std::string& nombre) {
+    if (nombre == "mel") return Espectrograma::TipoBanco::Mel;
+    if (nombre == "log") return Espectrograma::TipoBanco::Logaritmico;
+    throw std::invalid_argument("Banco de filtros desconocido: " + nombre + " (mel o log)");
+}
+
+// Interpretar el argumento de --cuantizar (8 o 16 bits)
+int leerBitsCuantizacion(const std::string& bits) {
+    if (bits == "8" || bits == "16") return std::stoi(bits);
+    throw std::invalid_argument("Cuantización no soportada: " + bits + " (8 o 16 bits)");
+}
+
+// Detectar picos por bloques con el espectrograma en float o cuantizado a 8 o
+// 16 bits (bitsCuantizacion = 0: float)
+DetectorPicos::Resultado detectarPicosFuente(FuenteAudio& fuente, const Espectrograma::Configuracion& configEspectro,
+                                             const DetectorPicos::Configuracion& configPicos, int bitsCuantizacion) {
+    switch (bitsCuantizacion) {
+        case 8:  return DetectorPicos::detectarPicos<uint8_t>(fuente, configEspectro, configPicos);
+        case 16: return DetectorPicos::detectarPicos<uint16_t>(fuente, configEspectro, configPicos);
+        default: return DetectorPicos::detectarPicos<float>(fuente, configEspectro, configPicos);
+    }
+}
+
+bool procesarArchivoParaIndexar(const std::string& rutaArchivo, BaseDatosHashes& baseDatos, bool prefiltro,
+                                int frecuenciaAnalisis, double umbralSilencioDB, bool soloRango,
+                                Espectrograma::TipoBanco banco, int bitsCuantizacion) {
     try {
         std::cout << "\n========================================" << std::endl;
         std::cout << "Procesando: " << fs::path(rutaArchivo).filename().string() << std::endl;
@@ -156,11 +270,11 @@ bool procesarArchivoParaIndexar(const std::string& rutaArchivo, BaseDatosHashes&
         
         auto inicio = std::chrono::high_resolution_clock::now();
         
-        // 1. Leer audio
-        std::cout << "[1/4] Leyendo audio..." << std::endl;
-        DatosAudio audio = LectorAudio::leerWAV(rutaArchivo);
-        std::cout << "  ✓ Duración: " << audio.duracion << "s, " 
-                  << audio.frecuenciaMuestreo << " Hz" << std::endl;
+        // 1. Abrir audio (se lee por bloques durante el espectrograma)
+        std::cout << "[1/4] Abriendo audio..." << std::endl;
+        std::unique_ptr<FuenteAudio> fuente = abrirFuente(rutaArchivo, prefiltro, frecuenciaAnalisis);
+        std::cout << "  ✓ Duración: " << (double)fuente->totalMuestras() / fuente->frecuenciaMuestreo() << "s, " 
+                  << fuente->frecuenciaMuestreo() << " Hz" << std::endl;
         
         // 2. Generar espectrograma
         std::cout << "[2/4] Generando espectrograma..." << std::endl;
@@ -168,9 +282,10 @@ bool procesarArchivoParaIndexar(const std::string& rutaArchivo, BaseDatosHashes&
         configEspectro.tamanoVentana = 1024;
         configEspectro.solapamiento = 512;
         configEspectro.aplicarHamming = true;
-        
-        auto espectrograma = Espectrograma::calcular(audio, configEspectro);
-        std::cout << "  ✓ Ventanas generadas: " << espectrograma.magnitudes.size() << std::endl;
+        configEspectro.escala = Espectrograma::Escala::Potencia;
+        configurarPuertaSilencio(configEspectro, umbralSilencioDB);
+        configurarRangoPicos(configEspectro, soloRango);
+        configEspectro.banco = banco;
         
         // 3. Detectar picos
         std::cout << "[3/4] Detectando picos..." << std::endl;
@@ -181,7 +296,11 @@ bool procesarArchivoParaIndexar(const std::string& rutaArchivo, BaseDatosHashes&
         configPicos.usarAdaptativo = true;
         configPicos.percentilUmbral = 75.0;
         
-        auto resultadoPicos = DetectorPicos::detectarPicos(espectrograma, configPicos);
+        // Pipeline de fingerprints en precisión simple y en potencia (sin
+        // raíces cuadradas) o en dB cuantizados; cada bloque del espectrograma
+        // se descarta en cuanto se extraen sus picos
+        auto resultadoPicos = detectarPicosFuente(*fuente, configEspectro, configPicos, bitsCuantizacion);
+        std::cout << "  ✓ Ventanas generadas: " << resultadoPicos.numVentanas << std::endl;
         auto picosFiltrados = DetectorPicos::filtrarPicos(
             resultadoPicos.picos, 0.15, 100.0, 5000.0
         );
@@ -200,7 +319,7 @@ bool procesarArchivoParaIndexar(const std::string& rutaArchivo, BaseDatosHashes&
         
         // 5. Agregar a la base de datos
         std::string nombreCancion = fs::path(rutaArchivo).filename().string();
-        baseDatos.agregarCancion(nombreCancion, rutaArchivo, audio.duracion, resultadoHashes.hashes);
+        baseDatos.agregarCancion(nombreCancion, rutaArchivo, fuente->duracionLeida(), resultadoHashes.hashes);
         
         auto fin = std::chrono::high_resolution_clock::now();
         auto duracion = std::chrono::duration_cast<std::chrono::seconds>(fin - inicio);
@@ -214,19 +333,57 @@ bool procesarArchivoParaIndexar(const std::string& rutaArchivo, BaseDatosHashes&
     }
 }
 
+void mostrarUsoIndexar(const char* programa) {
+    std::cout << "\nUso: " << programa << " --indexar <base_de_datos> <archivo1.wav> [archivo2.wav] ..." << std::endl;
+    std::cout << "\nEjemplos:" << std::endl;
+    std::cout << "  " << programa << " --indexar mi_database cancion1.wav cancion2.wav" << std::endl;
+    std::cout << "  " << programa << " --indexar mi_database --prefiltro cancion1.wav" << std::endl;
+    std::cout << "  " << programa << " --indexar mi_database --frecuencia-analisis 11025 cancion1.wav" << std::endl;
+    std::cout << "  " << programa << " --indexar mi_database --puerta-silencio -50 cancion1.wav" << std::endl;
+    std::cout << "  " << programa << " --indexar mi_database --rango-picos cancion1.wav" << std::endl;
+    std::cout << "  " << programa << " --indexar mi_database --banco mel cancion1.wav" << std::endl;
+    std::cout << "  " << programa << " --indexar mi_database --cuantizar 16 cancion1.wav" << std::endl;
+}
+
 int modoIndexar(int argc, char* argv[]) {
     if (argc < 3) {
-        std::cout << "\nUso: " << argv[0] << " --indexar <base_de_datos> <archivo1.wav> [archivo2.wav] ..." << std::endl;
-        std::cout << "\nEjemplos:" << std::endl;
-        std::cout << "  " << argv[0] << " --indexar mi_database cancion1.wav cancion2.wav" << std::endl;
+        mostrarUsoIndexar(argv[0]);
         return 1;
     }
     
     std::string nombreDB = argv[2];
     std::vector<std::string> archivos;
+    bool prefiltro = false;
+    int frecuenciaAnalisis = 0;     // 0: analizar a la frecuencia de cada archivo
+    double umbralSilencioDB = 0.0;  // 0: sin puerta de energía
+    bool soloRango = false;         // Espectrograma sólo en el rango de los picos
+    Espectrograma::TipoBanco banco = Espectrograma::TipoBanco::Ninguno;
+    int bitsCuantizacion = 0;       // 0: espectrograma en float
     
-    for (int i = 3; i < argc; i++) {
-        archivos.push_back(argv[i]);
+    // Un valor inválido (número mal escrito, --banco o --cuantizar
+    // desconocidos) termina con el uso en lugar de abortar
+    try {
+        for (int i = 3; i < argc; i++) {
+            if (std::string(argv[i]) == "--prefiltro") {
+                prefiltro = true;
+            } else if (std::string(argv[i]) == "--frecuencia-analisis" && i + 1 < argc) {
+                frecuenciaAnalisis = std::stoi(argv[++i]);
+            } else if (std::string(argv[i]) == "--puerta-silencio" && i + 1 < argc) {
+                umbralSilencioDB = std::stod(argv[++i]);
+            } else if (std::string(argv[i]) == "--rango-picos") {
+                soloRango = true;
+            } else if (std::string(argv[i]) == "--banco" && i + 1 < argc) {
+                banco = leerTipoBanco(argv[++i]);
+            } else if (std::string(argv[i]) == "--cuantizar" && i + 1 < argc) {
+                bitsCuantizacion = leerBitsCuantizacion(argv[++i]);
+            } else {
+                archivos.push_back(argv[i]);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error en los argumentos: " << e.what() << std::endl;
+        mostrarUsoIndexar(argv[0]);
+        return 1;
     }
     
     std::cout << "============================================" << std::endl;
@@ -250,7 +407,8 @@ int modoIndexar(int argc, char* argv[]) {
     int exitosos = 0, fallidos = 0;
     
     for (const auto& archivo : archivos) {
-        if (procesarArchivoParaIndexar(archivo, baseDatos)) {
+        if (procesarArchivoParaIndexar(archivo, baseDatos, prefiltro, frecuenciaAnalisis, umbralSilencioDB, soloRango,
+                                       banco, bitsCuantizacion)) {
             exitosos++;
         } else {
             fallidos++;
@@ -288,19 +446,24 @@ int modoIndexar(int argc, char* argv[]) {
 
 // MODO 3: BUSCAR CANCIÓN
 
-std::vector<GeneradorHashes::Hash> procesarQuery(const std::string& rutaArchivo) {
+std::vector<GeneradorHashes::Hash> procesarQuery(const std::string& rutaArchivo, bool prefiltro,
+                                                 int frecuenciaAnalisis, double umbralSilencioDB, bool soloRango,
+                                                 Espectrograma::TipoBanco banco, int bitsCuantizacion,
+                                                 int frecuenciaEntrada, int canalesEntrada) {
     std::cout << "\n=== Procesando Audio Query ===" << std::endl;
     
-    DatosAudio audio = LectorAudio::leerWAV(rutaArchivo);
-    std::cout << "[1/4] Audio leído: " << audio.duracion << "s" << std::endl;
+    // El query debe filtrarse y remuestrearse igual que las canciones indexadas
+    std::unique_ptr<FuenteAudio> fuente = abrirFuente(rutaArchivo, prefiltro, frecuenciaAnalisis,
+                                                      frecuenciaEntrada, canalesEntrada);
     
     Espectrograma::Configuracion configEspectro;
     configEspectro.tamanoVentana = 1024;
     configEspectro.solapamiento = 512;
     configEspectro.aplicarHamming = true;
-    
-    auto espectrograma = Espectrograma::calcular(audio, configEspectro);
-    std::cout << "[2/4] Espectrograma: " << espectrograma.magnitudes.size() << " ventanas" << std::endl;
+    configEspectro.escala = Espectrograma::Escala::Potencia;
+    configurarPuertaSilencio(configEspectro, umbralSilencioDB);
+    configurarRangoPicos(configEspectro, soloRango);
+    configEspectro.banco = banco;
     
     DetectorPicos::Configuracion configPicos;
     configPicos.umbralMagnitud = 0.1;
@@ -308,7 +471,10 @@ std::vector<GeneradorHashes::Hash> procesarQuery(const std::string& rutaArchivo)
     configPicos.picosPorBanda = 5;
     configPicos.usarAdaptativo = true;
     
-    auto resultadoPicos = DetectorPicos::detectarPicos(espectrograma, configPicos);
+    auto resultadoPicos = detectarPicosFuente(*fuente, configEspectro, configPicos, bitsCuantizacion);
+    std::cout << "[1/4] Audio leído: " << fuente->duracionLeida() << "s" << std::endl;
+    std::cout << "[2/4] Espectrograma: " << resultadoPicos.numVentanas << " ventanas" << std::endl;
+    
     auto picosFiltrados = DetectorPicos::filtrarPicos(resultadoPicos.picos, 0.15, 100.0, 5000.0);
     std::cout << "[3/4] Picos detectados: " << picosFiltrados.size() << std::endl;
     
@@ -322,24 +488,63 @@ std::vector<GeneradorHashes::Hash> procesarQuery(const std::string& rutaArchivo)
     return resultadoHashes.hashes;
 }
 
+void mostrarUsoBuscar(const char* programa) {
+    std::cout << "\nUso: " << programa << " --buscar <base_de_datos> <query.wav | -> [--top N] [--prefiltro]"
+              << " [--frecuencia-analisis Hz] [--puerta-silencio dBFS] [--rango-picos] [--banco mel|log] [--cuantizar 8|16] [--frecuencia Hz] [--canales N]" << std::endl;
+    std::cout << "\nEjemplos:" << std::endl;
+    std::cout << "  " << programa << " --buscar mi_database query.wav" << std::endl;
+    std::cout << "  " << programa << " --buscar mi_database query.wav --top 5" << std::endl;
+    std::cout << "  arecord -f S16_LE -r 44100 -c 2 -d 10 | " << programa << " --buscar mi_database -" << std::endl;
+}
+
 int modoBuscar(int argc, char* argv[]) {
     if (argc < 4) {
-        std::cout << "\nUso: " << argv[0] << " --buscar <base_de_datos> <query.wav> [--top N]" << std::endl;
-        std::cout << "\nEjemplos:" << std::endl;
-        std::cout << "  " << argv[0] << " --buscar mi_database query.wav" << std::endl;
-        std::cout << "  " << argv[0] << " --buscar mi_database query.wav --top 5" << std::endl;
+        mostrarUsoBuscar(argv[0]);
         return 1;
     }
     
     std::string nombreDB = argv[2];
     std::string archivoQuery = argv[3];
     int topN = 1;
+    bool prefiltro = false;
+    int frecuenciaEntrada = 44100;  // Formato del PCM crudo cuando el query es "-" (stdin)
+    int canalesEntrada = 2;
+    int frecuenciaAnalisis = 0;
+    double umbralSilencioDB = 0.0;
+    bool soloRango = false;
+    Espectrograma::TipoBanco banco = Espectrograma::TipoBanco::Ninguno;
+    int bitsCuantizacion = 0;
     
-    // Parsear --top
-    for (int i = 4; i < argc; i++) {
-        if (std::string(argv[i]) == "--top" && i + 1 < argc) {
-            topN = std::stoi(argv[++i]);
+    // Parsear --top, --prefiltro, --frecuencia-analisis, --puerta-silencio, --rango-picos,
+    // --banco, --cuantizar, --frecuencia y --canales
+    // Un valor inválido (número mal escrito, --banco o --cuantizar
+    // desconocidos) termina con el uso en lugar de abortar
+    try {
+        for (int i = 4; i < argc; i++) {
+            if (std::string(argv[i]) == "--top" && i + 1 < argc) {
+                topN = std::stoi(argv[++i]);
+            } else if (std::string(argv[i]) == "--prefiltro") {
+                prefiltro = true;
+            } else if (std::string(argv[i]) == "--frecuencia-analisis" && i + 1 < argc) {
+                frecuenciaAnalisis = std::stoi(argv[++i]);
+            } else if (std::string(argv[i]) == "--puerta-silencio" && i + 1 < argc) {
+                umbralSilencioDB = std::stod(argv[++i]);
+            } else if (std::string(argv[i]) == "--rango-picos") {
+                soloRango = true;
+            } else if (std::string(argv[i]) == "--banco" && i + 1 < argc) {
+                banco = leerTipoBanco(argv[++i]);
+            } else if (std::string(argv[i]) == "--cuantizar" && i + 1 < argc) {
+                bitsCuantizacion = leerBitsCuantizacion(argv[++i]);
+            } else if (std::string(argv[i]) == "--frecuencia" && i + 1 < argc) {
+                frecuenciaEntrada = std::stoi(argv[++i]);
+            } else if (std::string(argv[i]) == "--canales" && i + 1 < argc) {
+                canalesEntrada = std::stoi(argv[++i]);
+            }
         }
+    } catch (const std::exception& e) {
+        std::cerr << "Error en los argumentos: " << e.what() << std::endl;
+        mostrarUsoBuscar(argv[0]);
+        return 1;
     }
     
     std::cout << "============================================" << std::endl;
@@ -361,7 +566,8 @@ int modoBuscar(int argc, char* argv[]) {
         baseDatos.mostrarInfo();
         
         // Procesar query
-        auto hashesQuery = procesarQuery(archivoQuery);
+        auto hashesQuery = procesarQuery(archivoQuery, prefiltro, frecuenciaAnalisis, umbralSilencioDB, soloRango, banco,
+                                         bitsCuantizacion, frecuenciaEntrada, canalesEntrada);
         
         if (hashesQuery.empty()) {
             std::cerr << "Error: No se generaron fingerprints del query" << std::endl;
@@ -414,15 +620,27 @@ int main(int argc, char* argv[]) {
         std::cout << "============================================" << std::endl;
         std::cout << "\nModos de uso:" << std::endl;
         std::cout << "\n1. DEMO COMPLETO (Fases 1-5):" << std::endl;
-        std::cout << "   " << argv[0] << " <archivo.wav>" << std::endl;
-        std::cout << "   Ejecuta análisis completo y genera archivos CSV" << std::endl;
+        std::cout << "   " << argv[0] << " <archivo.wav> [--formato csv|npy|crudo]" << std::endl;
+        std::cout << "   Ejecuta análisis completo y genera archivos CSV (o matrices float32 .npy/.bin)" << std::endl;
         
         std::cout << "\n2. INDEXAR CANCIONES:" << std::endl;
-        std::cout << "   " << argv[0] << " --indexar <database> <cancion1.wav> [cancion2.wav] ..." << std::endl;
+        std::cout << "   " << argv[0] << " --indexar <database> [--prefiltro] [--frecuencia-analisis Hz] [--puerta-silencio dBFS] [--rango-picos] [--banco mel|log] [--cuantizar 8|16] <cancion1.wav> [cancion2.wav] ..." << std::endl;
         std::cout << "   Crea base de datos con fingerprints de canciones" << std::endl;
+        std::cout << "   --prefiltro: pasa banda 100-5000 Hz antes del espectrograma (usarlo también al buscar)" << std::endl;
+        std::cout << "   --frecuencia-analisis: remuestrear a una frecuencia común (p. ej. 11025) antes del"
+                  << " espectrograma (usar la misma al buscar)" << std::endl;
+        std::cout << "   --puerta-silencio: no analizar las ventanas con RMS menor que el umbral (p. ej. -50),"
+                  << " y recortar el silencio inicial y final" << std::endl;
+        std::cout << "   --rango-picos: calcular y analizar sólo los bins de 100-5000 Hz, donde se conservan"
+                  << " los picos (usarlo también al buscar)" << std::endl;
+        std::cout << "   --banco mel|log: detectar picos sobre 64 filtros mel o logarítmicos en lugar de"
+                  << " los bins de la FFT (usar el mismo al buscar)" << std::endl;
+        std::cout << "   --cuantizar 8|16: espectrograma en dB cuantizados a 8 o 16 bits; picos con"
+                  << " comparaciones enteras y percentiles por histograma" << std::endl;
         
         std::cout << "\n3. BUSCAR/IDENTIFICAR:" << std::endl;
-        std::cout << "   " << argv[0] << " --buscar <database> <query.wav> [--top N]" << std::endl;
+        std::cout << "   " << argv[0] << " --buscar <database> <query.wav | -> [--top N] [--prefiltro]"
+                  << " [--frecuencia-analisis Hz] [--puerta-silencio dBFS] [--rango-picos] [--banco mel|log] [--cuantizar 8|16] [--frecuencia Hz] [--canales N]" << std::endl;
         std::cout << "   Identifica una canción desde un fragmento de audio" << std::endl;
         
         std::cout << "\n============================================" << std::endl;
@@ -440,6 +658,10 @@ int main(int argc, char* argv[]) {
     } 
     else {
         // Modo demo por defecto
-        return modoDemo(primerArg);
+        std::string formatoSalida = "csv";
+        if (argc >= 4 && std::string(argv[2]) == "--formato") {
+            formatoSalida = argv[3];
+        }
+        return modoDemo(primerArg, formatoSalida);
     }
 }
\ No newline at end of file
@@ -1,12 +1,49 @@
 #include "DetectorPicos.h"
 #include <iostream>
-#include <fstream>
 #include <algorithm>
 #include <cmath>
-#include <iomanip>
+#include <stdexcept>
+#include <type_traits>
 
+namespace {
+// Avisar cuando las filas son más estrechas que una vecindad completa
+// (rango de frecuencias o banco de filtros demasiado pequeño): no habrá picos
+void avisarFilasEstrechas(int columnas, int radio) {
+    if (columnas < 2 * radio + 1) {
+        std::cout << "  Aviso: " << columnas << " columnas por ventana, menos que la vecindad de "
+                  << 2 * radio + 1 << " del radio " << radio << ": no se detectarán picos" << std::endl;
+    }
+}
+
+// Valor en la posición 'posicion' de los valores enteros ordenados, sin
+// ordenarlos: un histograma de 256 casillas por byte, del más alto al más
+// bajo (una pasada para uint8_t, dos para uint16_t)
+template <typename T>
+T valorEnPosicion(Vista<T> valores, size_t posicion) {
+    uint32_t prefijo = 0;
+    for (int nivel = (int)sizeof(T) - 1; nivel >= 0; nivel--) {
+        int desplazamiento = 8 * nivel;
+        size_t cuenta[256] = {};
+        for (T valor : valores) {
+            if (((uint32_t)valor >> (desplazamiento + 8)) == (prefijo >> (desplazamiento + 8))) {
+                cuenta[((uint32_t)valor >> desplazamiento) & 255]++;
+            }
+        }
+        
+        int casilla = 0;
+        while (posicion >= cuenta[casilla]) {
+            posicion -= cuenta[casilla];
+            casilla++;
+        }
+        prefijo |= (uint32_t)casilla << desplazamiento;
+    }
+    return (T)prefijo;
+}
+}
+
+template <typename T>
 DetectorPicos::Resultado DetectorPicos::detectarPicos(
-    const Espectrograma::Resultado& espectrograma,
+    const Espectrograma::Resultado<T>& espectrograma,
     const Configuracion& config
 ) {
     std::cout << "\n=== Detección de Picos Espectrales ===" << std::endl;
@@ -16,51 +53,23 @@ DetectorPicos::Resultado DetectorPicos::detectarPicos(
     std::cout << "  Picos por ventana: " << config.picosPorBanda << std::endl;
     std::cout << "  Umbral adaptativo: " << (config.usarAdaptativo ? "Sí" : "No") << std::endl;
     
+    avisarFilasEstrechas(espectrograma.numFrecuencias, config.vecinosLocales);
+    
     Resultado resultado;
-    resultado.tiempoTotal = espectrograma.magnitudes.size() * espectrograma.resolucionTemporal;
+    resultado.numVentanas = espectrograma.numVentanas;
+    resultado.tiempoTotal = espectrograma.numVentanas * espectrograma.resolucionTemporal;
     
     // Procesar cada ventana temporal
     int porcentajeAnterior = -1;
-    for (size_t v = 0; v < espectrograma.magnitudes.size(); v++) {
+    for (size_t v = 0; v < (size_t)espectrograma.numVentanas; v++) {
         // Mostrar progreso
-        int porcentaje = (100 * v) / espectrograma.magnitudes.size();
+        int porcentaje = (100 * v) / espectrograma.numVentanas;
         if (porcentaje != porcentajeAnterior && porcentaje % 20 == 0) {
             std::cout << "  Progreso: " << porcentaje << "%" << std::endl;
             porcentajeAnterior = porcentaje;
         }
         
-        const std::vector<double>& magnitudes = espectrograma.magnitudes[v];
-        double tiempo = v * espectrograma.resolucionTemporal;
-        
-        // Calcular umbral para esta ventana
-        double umbral = config.umbralMagnitud;
-        if (config.usarAdaptativo) {
-            umbral = calcularUmbralAdaptativo(magnitudes, config.percentilUmbral);
-        }
-        
-        // Detectar máximos locales
-        std::vector<int> indicesMaximos = detectarMaximosLocales(magnitudes, config.vecinosLocales);
-        
-        // Filtrar por umbral y crear picos
-        std::vector<std::pair<double, int>> picosTemporales;
-        for (int idx : indicesMaximos) {
-            if (magnitudes[idx] >= umbral) {
-                picosTemporales.push_back({magnitudes[idx], idx});
-            }
-        }
-        
-        // Ordenar por magnitud descendente y tomar los N más fuertes
-        std::sort(picosTemporales.begin(), picosTemporales.end(),
-                  [](const auto& a, const auto& b) { return a.first > b.first; });
-        
-        int numPicos = std::min((int)picosTemporales.size(), config.picosPorBanda);
-        for (int i = 0; i < numPicos; i++) {
-            double magnitud = picosTemporales[i].first;
-            int indiceFrecuencia = picosTemporales[i].second;
-            double frecuencia = indiceFrecuencia * espectrograma.resolucionFrecuencia;
-            
-            resultado.picos.emplace_back(tiempo, frecuencia, magnitud, 0, v, indiceFrecuencia);
-        }
+        detectarPicosVentana(espectrograma, v, v, config, resultado.picos);
     }
     
     resultado.totalPicosDetectados = resultado.picos.size();
@@ -69,11 +78,104 @@ DetectorPicos::Resultado DetectorPicos::detectarPicos(
     std::cout << "\n✓ Detección de picos completada" << std::endl;
     std::cout << "  Total de picos detectados: " << resultado.totalPicosDetectados << std::endl;
     std::cout << "  Promedio de picos por ventana: " 
-              << (double)resultado.totalPicosDetectados / espectrograma.magnitudes.size() << std::endl;
+              << (double)resultado.totalPicosDetectados / espectrograma.numVentanas << std::endl;
     
     return resultado;
 }
 
+template <typename T>
+DetectorPicos::Resultado DetectorPicos::detectarPicos(
+    FuenteAudio& fuente,
+    const Espectrograma::Configuracion& configEspectro,
+    const Configuracion& config
+) {
+    std::cout << "\n=== Detección de Picos Espectrales por bloques ===" << std::endl;
+    std::cout << "  Picos por ventana: " << config.picosPorBanda << std::endl;
+    std::cout << "  Umbral adaptativo: " << (config.usarAdaptativo ? "Sí" : "No") << std::endl;
+    
+    Resultado resultado;
+    double resolucionTemporal = 0.0;
+    bool avisado = false;
+    
+    // Cada tramo del espectrograma se analiza en cuanto se calcula y se descarta
+    int numVentanas = Espectrograma::calcularPorBloques<T>(fuente, configEspectro,
+        [&](const Espectrograma::Resultado<T>& tramo, int primeraVentana) {
+            resolucionTemporal = tramo.resolucionTemporal;
+            if (!avisado) {
+                avisarFilasEstrechas(tramo.numFrecuencias, config.vecinosLocales);
+                avisado = true;
+            }
+            for (int f = 0; f < tramo.numVentanas; f++) {
+                detectarPicosVentana(tramo, f, primeraVentana + f, config, resultado.picos);
+            }
+        });
+    
+    resultado.numVentanas = numVentanas;
+    resultado.tiempoTotal = numVentanas * resolucionTemporal;
+    resultado.totalPicosDetectados = resultado.picos.size();
+    
+    std::cout << "\n✓ Detección de picos completada" << std::endl;
+    std::cout << "  Total de picos detectados: " << resultado.totalPicosDetectados << std::endl;
+    
+    return resultado;
+}
+
+template <typename T>
+void DetectorPicos::detectarPicosVentana(
+    const Espectrograma::Resultado<T>& espectrograma,
+    size_t fila,
+    int indiceVentana,
+    const Configuracion& config,
+    std::vector<Pico>& picos
+) {
+    if (!espectrograma.conMagnitudes) {
+        throw std::invalid_argument("El espectrograma sólo guardó sus bandas (Configuracion::guardarMagnitudes)");
+    }
+    
+    // Las ventanas descartadas por la puerta de energía no aportan picos
+    if (!espectrograma.silencio.empty() && espectrograma.silencio[fila]) {
+        return;
+    }
+    
+    // Sólo las columnas guardadas: con un rango de frecuencias, el umbral
+    // adaptativo y los máximos locales se calculan dentro del rango
+    Vista<T> magnitudes = espectrograma.fila(fila);
+    double tiempo = indiceVentana * espectrograma.resolucionTemporal;
+    
+    // Calcular umbral para esta ventana (en la escala del espectrograma). Con
+    // espectrogramas de potencia se compara directamente en esa escala
+    // (conserva el orden) y sólo los picos elegidos vuelven a magnitud; con
+    // los cuantizados las comparaciones son entre enteros de la fila
+    double umbral = espectrograma.valorDe(fila, config.umbralMagnitud);
+    if (config.usarAdaptativo) {
+        umbral = calcularUmbralAdaptativo(magnitudes, config.percentilUmbral);
+    }
+    
+    // Detectar máximos locales
+    std::vector<int> indicesMaximos = detectarMaximosLocales(magnitudes, config.vecinosLocales);
+    
+    // Filtrar por umbral y crear picos
+    std::vector<std::pair<double, int>> picosTemporales;
+    for (int idx : indicesMaximos) {
+        if (magnitudes[idx] >= umbral) {
+            picosTemporales.push_back({(double)magnitudes[idx], idx});
+        }
+    }
+    
+    // Ordenar por magnitud descendente y tomar los N más fuertes
+    std::sort(picosTemporales.begin(), picosTemporales.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    
+    int numPicos = std::min((int)picosTemporales.size(), config.picosPorBanda);
+    for (int i = 0; i < numPicos; i++) {
+        double magnitud = espectrograma.magnitudDe(fila, picosTemporales[i].first);
+        int indiceFrecuencia = espectrograma.primerBin + picosTemporales[i].second;
+        double frecuencia = espectrograma.frecuencia(picosTemporales[i].second);
+        
+        picos.emplace_back(tiempo, frecuencia, magnitud, 0, indiceVentana, indiceFrecuencia);
+    }
+}
+
 DetectorPicos::Resultado DetectorPicos::detectarPicosEnBandas(
     const std::vector<std::vector<double>>& bandas,
     const std::vector<std::pair<double, double>>& definicionesBandas,
@@ -96,7 +198,7 @@ DetectorPicos::Resultado DetectorPicos::detectarPicosEnBandas(
                 magnitudesBanda.push_back(ventana[b]);
             }
             resultado.umbralesPorBanda[b] = calcularUmbralAdaptativo(
-                magnitudesBanda, config.percentilUmbral
+                Vista<double>(magnitudesBanda.data(), magnitudesBanda.size()), config.percentilUmbral
             );
             std::cout << "  Banda " << (b+1) << " (" 
                       << definicionesBandas[b].first << "-" 
@@ -148,13 +250,16 @@ DetectorPicos::Resultado DetectorPicos::detectarPicosEnBandas(
     return resultado;
 }
 
+template <typename T>
 std::vector<int> DetectorPicos::detectarMaximosLocales(
-    const std::vector<double>& magnitudes,
+    Vista<T> magnitudes,
     int radio
 ) {
     std::vector<int> maximos;
     
-    for (size_t i = radio; i < magnitudes.size() - radio; i++) {
+    // Una fila más estrecha que una vecindad completa (2 · radio + 1
+    // columnas, posible con un rango de frecuencias) no tiene máximos
+    for (size_t i = radio; i + radio < magnitudes.size(); i++) {
         bool esMaximo = true;
         
         // Verificar si es máximo en su vecindad
@@ -174,14 +279,21 @@ std::vector<int> DetectorPicos::detectarMaximosLocales(
     return maximos;
 }
 
-double DetectorPicos::calcularUmbralAdaptativo(
-    const std::vector<double>& magnitudes,
+template <typename T>
+T DetectorPicos::calcularUmbralAdaptativo(
+    Vista<T> magnitudes,
     double percentil
 ) {
-    if (magnitudes.empty()) return 0.0;
+    if (magnitudes.empty()) return T(0);
+    
+    // Enteros (espectrogramas cuantizados): histograma en lugar de ordenar
+    if constexpr (std::is_integral<T>::value) {
+        size_t indice = std::min((size_t)(percentil / 100.0 * magnitudes.size()), magnitudes.size() - 1);
+        return valorEnPosicion(magnitudes, indice);
+    }
     
     // Copiar y ordenar magnitudes
-    std::vector<double> magOrdenadas = magnitudes;
+    std::vector<T> magOrdenadas(magnitudes.begin(), magnitudes.end());
     std::sort(magOrdenadas.begin(), magOrdenadas.end());
     
     // Calcular índice del percentil
@@ -199,56 +311,68 @@ void DetectorPicos::exportarCSV(
 ) {
     std::cout << "\nExportando picos a CSV..." << std::endl;
     
-    std::ofstream archivo(nombreArchivo);
-    if (!archivo.is_open()) {
-        throw std::runtime_error("No se pudo crear el archivo: " + nombreArchivo);
-    }
+    EscritorArchivo archivo(nombreArchivo);
     
     // Escribir encabezado
-    archivo << "Tiempo(s),Frecuencia(Hz),Magnitud,Banda,VentanaIdx,FrecuenciaIdx" << std::endl;
+    archivo.texto("Tiempo(s),Frecuencia(Hz),Magnitud,Banda,VentanaIdx,FrecuenciaIdx\n");
     
     // Escribir picos
     for (const auto& pico : resultado.picos) {
-        archivo << std::fixed << std::setprecision(6)
-                << pico.tiempo << ","
-                << pico.frecuencia << ","
-                << std::scientific << std::setprecision(6)
-                << pico.magnitud << ","
-                << pico.indiceBanda << ","
-                << pico.indiceVentana << ","
-                << pico.indiceFrecuencia << std::endl;
+        archivo.fijo(pico.tiempo, 6).caracter(',')
+               .fijo(pico.frecuencia, 6).caracter(',')
+               .cientifico(pico.magnitud, 6).caracter(',')
+               .entero(pico.indiceBanda).caracter(',')
+               .entero(pico.indiceVentana).caracter(',')
+               .entero(pico.indiceFrecuencia).caracter('\n');
     }
     
-    archivo.close();
+    archivo.cerrar();
     std::cout << "✓ Picos exportados a '" << nombreArchivo << "'" << std::endl;
 }
 
+void DetectorPicos::exportarBinario(
+    const Resultado& resultado,
+    const std::string& nombreArchivo,
+    FormatoBinario formato
+) {
+    EscritorArchivo archivo(nombreArchivo);
+    archivo.cabeceraMatriz(formato, EscritorArchivo::matrizPicos, resultado.picos.size(), 6);
+    
+    // Mismas columnas que el CSV; los índices son exactos en float32 (< 2^24)
+    for (const auto& pico : resultado.picos) {
+        float fila[6] = {
+            (float)pico.tiempo, (float)pico.frecuencia, (float)pico.magnitud,
+            (float)pico.indiceBanda, (float)pico.indiceVentana, (float)pico.indiceFrecuencia
+        };
+        archivo.bytes(fila, sizeof(fila));
+    }
+    
+    archivo.cerrar();
+    std::cout << "✓ Picos exportados a '" << nombreArchivo << "' ("
+              << resultado.picos.size() << " × 6 float32)" << std::endl;
+}
+
 void DetectorPicos::exportarConstelacion(
     const Resultado& resultado,
     const std::string& nombreArchivo
 ) {
     std::cout << "\nExportando constelación de picos..." << std::endl;
     
-    std::ofstream archivo(nombreArchivo);
-    if (!archivo.is_open()) {
-        throw std::runtime_error("No se pudo crear el archivo: " + nombreArchivo);
-    }
+    EscritorArchivo archivo(nombreArchivo);
     
     // Formato de constelación: (tiempo, frecuencia, magnitud)
-    archivo << "# Constelación de Picos Espectrales" << std::endl;
-    archivo << "# Total de picos: " << resultado.totalPicosDetectados << std::endl;
-    archivo << "# Duración: " << resultado.tiempoTotal << " segundos" << std::endl;
-    archivo << "# Formato: tiempo(s) frecuencia(Hz) magnitud" << std::endl;
+    archivo.texto("# Constelación de Picos Espectrales\n");
+    archivo.texto("# Total de picos: ").entero(resultado.totalPicosDetectados).caracter('\n');
+    archivo.texto("# Duración: ").general(resultado.tiempoTotal).texto(" segundos\n");
+    archivo.texto("# Formato: tiempo(s) frecuencia(Hz) magnitud\n");
     
     for (const auto& pico : resultado.picos) {
-        archivo << std::fixed << std::setprecision(4)
-                << pico.tiempo << " "
-                << pico.frecuencia << " "
-                << std::scientific << std::setprecision(6)
-                << pico.magnitud << std::endl;
+        archivo.fijo(pico.tiempo, 4).caracter(' ')
+               .fijo(pico.frecuencia, 4).caracter(' ')
+               .cientifico(pico.magnitud, 6).caracter('\n');
     }
     
-    archivo.close();
+    archivo.cerrar();
     std::cout << "✓ Constelación exportada a '" << nombreArchivo << "'" << std::endl;
 }
 
@@ -269,4 +393,38 @@ std::vector<DetectorPicos::Pico> DetectorPicos::filtrarPicos(
     }
     
     return picosFiltrados;
-}
\ No newline at end of file
+}
+
+// Instancias usadas por el proyecto
+template DetectorPicos::Resultado DetectorPicos::detectarPicos<float>(
+    const Espectrograma::Resultado<float>&, const Configuracion&);
+template DetectorPicos::Resultado DetectorPicos::detectarPicos<double>(
+    const Espectrograma::Resultado<double>&, const Configuracion&);
+template DetectorPicos::Resultado DetectorPicos::detectarPicos<float>(
+    FuenteAudio&, const Espectrograma::Configuracion&, const Configuracion&);
+template DetectorPicos::Resultado DetectorPicos::detectarPicos<double>(
+    FuenteAudio&, const Espectrograma::Configuracion&, const Configuracion&);
+template void DetectorPicos::detectarPicosVentana<float>(
+    const Espectrograma::Resultado<float>&, size_t, int, const Configuracion&, std::vector<Pico>&);
+template void DetectorPicos::detectarPicosVentana<double>(
+    const Espectrograma::Resultado<double>&, size_t, int, const Configuracion&, std::vector<Pico>&);
+template DetectorPicos::Resultado DetectorPicos::detectarPicos<uint8_t>(
+    const Espectrograma::Resultado<uint8_t>&, const Configuracion&);
+template DetectorPicos::Resultado DetectorPicos::detectarPicos<uint16_t>(
+    const Espectrograma::Resultado<uint16_t>&, const Configuracion&);
+template DetectorPicos::Resultado DetectorPicos::detectarPicos<uint8_t>(
+    FuenteAudio&, const Espectrograma::Configuracion&, const Configuracion&);
+template DetectorPicos::Resultado DetectorPicos::detectarPicos<uint16_t>(
+    FuenteAudio&, const Espectrograma::Configuracion&, const Configuracion&);
+template void DetectorPicos::detectarPicosVentana<uint8_t>(
+    const Espectrograma::Resultado<uint8_t>&, size_t, int, const Configuracion&, std::vector<Pico>&);
+template void DetectorPicos::detectarPicosVentana<uint16_t>(
+    const Espectrograma::Resultado<uint16_t>&, size_t, int, const Configuracion&, std::vector<Pico>&);
+template std::vector<int> DetectorPicos::detectarMaximosLocales<float>(Vista<float>, int);
+template std::vector<int> DetectorPicos::detectarMaximosLocales<double>(Vista<double>, int);
+template std::vector<int> DetectorPicos::detectarMaximosLocales<uint8_t>(Vista<uint8_t>, int);
+template std::vector<int> DetectorPicos::detectarMaximosLocales<uint16_t>(Vista<uint16_t>, int);
+template float DetectorPicos::calcularUmbralAdaptativo<float>(Vista<float>, double);
+template double DetectorPicos::calcularUmbralAdaptativo<double>(Vista<double>, double);
+template uint8_t DetectorPicos::calcularUmbralAdaptativo<uint8_t>(Vista<uint8_t>, double);
+template uint16_t DetectorPicos::calcularUmbralAdaptativo<uint16_t>(Vista<uint16_t>, double);
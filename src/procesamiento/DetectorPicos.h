@@ -14,7 +14,7 @@ public:
         double magnitud;        // Magnitud del pico
         int indiceBanda;        // Índice de la banda de frecuencia
         int indiceVentana;      // Índice de la ventana temporal
-        int indiceFrecuencia;   // Índice dentro de la banda
+        int indiceFrecuencia;   // Bin de frecuencia (filtro con banco de filtros, 0 en los picos por bandas)
         
         // Constructor
         Pico(double t, double f, double m, int banda, int ventana, int freq)
@@ -35,16 +35,38 @@ public:
     struct Resultado {
         std::vector<Pico> picos;
         int totalPicosDetectados;
+        int numVentanas = 0;                   // Ventanas analizadas
         double tiempoTotal;
         std::vector<double> umbralesPorBanda;  // Umbrales usados por banda
     };
     
-    // Detectar picos en espectrograma completo
+    // Detectar picos en espectrograma completo (magnitudes float o double)
+    template <typename T>
     static Resultado detectarPicos(
-        const Espectrograma::Resultado& espectrograma,
+        const Espectrograma::Resultado<T>& espectrograma,
         const Configuracion& config
     );
     
+    // Detectar picos leyendo la fuente por bloques (Espectrograma::calcularPorBloques):
+    // el espectrograma completo nunca se guarda, sólo los picos
+    template <typename T>
+    static Resultado detectarPicos(
+        FuenteAudio& fuente,
+        const Espectrograma::Configuracion& configEspectro,
+        const Configuracion& config
+    );
+    
+    // Detectar los picos de la fila 'fila' del espectrograma, que corresponde
+    // a la ventana global 'indiceVentana', y agregarlos a 'picos'
+    template <typename T>
+    static void detectarPicosVentana(
+        const Espectrograma::Resultado<T>& espectrograma,
+        size_t fila,
+        int indiceVentana,
+        const Configuracion& config,
+        std::vector<Pico>& picos
+    );
+    
     // Detectar picos en bandas de frecuencia
     static Resultado detectarPicosEnBandas(
         const std::vector<std::vector<double>>& bandas,
@@ -53,15 +75,18 @@ public:
         const Configuracion& config
     );
     
-    // Detectar máximos locales en una ventana
+    // Detectar máximos locales en una ventana: las columnas con 'radio'
+    // vecinas a cada lado (ninguno si hay menos de 2 · radio + 1 columnas)
+    template <typename T>
     static std::vector<int> detectarMaximosLocales(
-        const std::vector<double>& magnitudes,
+        Vista<T> magnitudes,
         int radio
     );
     
     // Calcular umbral adaptativo
-    static double calcularUmbralAdaptativo(
-        const std::vector<double>& magnitudes,
+    template <typename T>
+    static T calcularUmbralAdaptativo(
+        Vista<T> magnitudes,
         double percentil
     );
     
@@ -71,6 +96,14 @@ public:
         const std::string& nombreArchivo
     );
     
+    // Exportar picos como matriz float32 de 6 columnas (las del CSV), en
+    // NPY o con la cabecera propia de EscritorArchivo
+    static void exportarBinario(
+        const Resultado& resultado,
+        const std::string& nombreArchivo,
+        FormatoBinario formato = FormatoBinario::NPY
+    );
+    
     // Exportar picos a formato de constelación (para Fase 4)
     static void exportarConstelacion(
         const Resultado& resultado,
@@ -1,19 +1,339 @@
 #include "Espectrograma.h"
 #include "../fft/FFT.h"
+#include "../fft/FFTFijo.h"
 #include <iostream>
-#include <fstream>
 #include <cmath>
-#include <iomanip>
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-Espectrograma::Resultado Espectrograma::calcular(
+namespace {
+// Potencia mínima de la escala logarítmica (-120 dB), evita log10(0)
+const double pisoPotencia = 1e-12;
+
+// Tipo de la FFT y de las magnitudes antes de guardarlas
+template <typename T>
+using Calculo = typename PrecisionCalculo<T>::Tipo;
+
+// Guardar la fila v de dB (numFrecuencias valores) cuantizada: con escala por
+// ventana la base queda rangoDB por debajo del máximo de la fila
+template <typename T>
+void cuantizarFila(const float* dB, Espectrograma::Resultado<T>& resultado, size_t v) {
+    const float maximoValor = (float)std::numeric_limits<T>::max();
+    float base = (float)resultado.baseDB;
+    if (resultado.escalaPorVentana) {
+        float maximo = *std::max_element(dB, dB + resultado.numFrecuencias);
+        base = maximo - (float)(resultado.pasoDB * maximoValor);
+        resultado.basesFila[v] = base;
+    }
+    
+    const float inverso = (float)(1.0 / resultado.pasoDB);
+    T* valores = resultado.datosFila(v);
+    for (int i = 0; i < resultado.numFrecuencias; i++) {
+        float pasos = std::min(std::max((dB[i] - base) * inverso, 0.0f), maximoValor);
+        valores[i] = (T)(pasos + 0.5f);
+    }
+}
+
+// Transformar las numVentanas ventanas que empiezan en 'muestras' con 'plan'
+// (PlanFFTReal o FFTFijo), en lotes que comparten factores de giro y carriles
+// SIMD, y escribir sus magnitudes en las filas de 'resultado' a partir de
+// 'primeraFila' (ya reservadas)
+template <typename T, typename Transformada>
+void procesarVentanas(const float* muestras, int numVentanas, const Espectrograma::Configuracion& config,
+                      const std::vector<Calculo<T>>& ventana, const Transformada& plan,
+                      Espectrograma::Resultado<T>& resultado, int primeraFila, bool mostrarProgreso) {
+    using C = Calculo<T>;
+    constexpr bool cuantizado = std::is_integral<T>::value;
+    static_assert(sizeof(NumeroComplejo<C>) == 2 * sizeof(C), "NumeroComplejo debe ser (re, im) contiguos");
+    const NucleosFFT::Tabla& nucleos = NucleosFFT::activos();
+    const int ventanasPorLote = PlanFFT<C>::anchoLote;
+    std::vector<C> muestrasLote((size_t)ventanasPorLote * config.tamanoVentana);
+    std::vector<NumeroComplejo<C>> espectrosLote((size_t)ventanasPorLote * plan.numBins());
+    
+    // Sin matriz de magnitudes, cada fila se calcula en un búfer de paso
+    // sólo para acumular sus bandas; los espectrogramas cuantizados calculan
+    // ahí los dB de cada fila antes de guardarlos
+    const Espectrograma::PlanBandas& planBandas = resultado.planBandas;
+    std::vector<C> filaTemporal(resultado.conMagnitudes && !cuantizado ? 0 : resultado.numFrecuencias);
+    const Espectrograma::Escala escala = resultado.escala;
+    
+    // Con banco de filtros, potencia de los bins antes de agruparlos
+    const Espectrograma::BancoFiltros& banco = resultado.banco;
+    std::vector<C> potenciaBins(banco.vacio() ? 0 : banco.binMaximo + 1);
+    
+    // Procesar cada lote de ventanas
+    if (mostrarProgreso) {
+        std::cout << "\nProcesando ventanas..." << std::endl;
+    }
+    int porcentajeAnterior = -1;
+    
+    for (int primera = 0; primera < numVentanas; primera += ventanasPorLote) {
+        int enLote = std::min(ventanasPorLote, numVentanas - primera);
+        
+        // Preparar datos para FFT
+        for (int f = 0; f < enLote; f++) {
+            // Calcular posición de inicio de esta ventana
+            size_t inicio = (size_t)(primera + f) * config.solapamiento;
+            C* muestrasVentana = muestrasLote.data() + (size_t)f * config.tamanoVentana;
+            
+            for (int i = 0; i < config.tamanoVentana; i++) {
+                C muestra = muestras[inicio + i];
+                
+                // Aplicar ventana si está configurado
+                if (config.aplicarHamming) {
+                    muestra *= ventana[i];
+                }
+                
+                muestrasVentana[i] = muestra;
+            }
+        }
+        
+        // Aplicar FFT real al lote (sólo bins no redundantes)
+        plan.ejecutarLote(muestrasLote.data(), enLote, espectrosLote.data());
+        
+        for (int f = 0; f < enLote; f++) {
+            int v = primera + f;
+            
+            // Mostrar progreso
+            int porcentaje = (100 * v) / numVentanas;
+            if (mostrarProgreso && porcentaje != porcentajeAnterior && porcentaje % 10 == 0) {
+                std::cout << "  Progreso: " << porcentaje << "%" << std::endl;
+                porcentajeAnterior = porcentaje;
+            }
+            
+            // Extraer magnitudes (solo la mitad positiva del espectro)
+            const NumeroComplejo<C>* espectro = espectrosLote.data() + (size_t)f * plan.numBins()
+                                              + resultado.primerBin;
+            C* magnitudes = filaTemporal.data();
+            if constexpr (!cuantizado) {
+                if (resultado.conMagnitudes) {
+                    magnitudes = resultado.datosFila((size_t)primeraFila + v);
+                }
+            }
+            if (!banco.vacio()) {
+                // Potencia de los bins que cubre el banco y suma dispersa por filtro
+                nucleos.potencia(reinterpret_cast<const C*>(espectro + banco.binMinimo),
+                                 potenciaBins.data() + banco.binMinimo, banco.binMaximo - banco.binMinimo + 1);
+                Espectrograma::aplicarBanco(potenciaBins.data(), banco, magnitudes);
+                if (escala == Espectrograma::Escala::Magnitud) {
+                    for (int i = 0; i < resultado.numFrecuencias; i++) {
+                        magnitudes[i] = std::sqrt(magnitudes[i]);
+                    }
+                }
+            } else if (escala == Espectrograma::Escala::Magnitud) {
+                for (int i = 0; i < resultado.numFrecuencias; i++) {
+                    magnitudes[i] = espectro[i].magnitud();
+                }
+            } else {
+                // Potencia sin raíz cuadrada, con el núcleo vectorial activo
+                nucleos.potencia(reinterpret_cast<const C*>(espectro), magnitudes,
+                                 resultado.numFrecuencias);
+            }
+            if (escala == Espectrograma::Escala::PotenciaLog) {
+                for (int i = 0; i < resultado.numFrecuencias; i++) {
+                    magnitudes[i] = C(10) * std::log10(std::max(magnitudes[i], C(pisoPotencia)));
+                }
+            }
+            
+            // Bandas con la fila todavía en caché (en dB si se cuantiza)
+            if (!planBandas.vacio()) {
+                Espectrograma::agregarBandas(magnitudes, planBandas, resultado.datosBandas((size_t)primeraFila + v));
+            }
+            if constexpr (cuantizado) {
+                if (resultado.conMagnitudes) {
+                    cuantizarFila(magnitudes, resultado, (size_t)primeraFila + v);
+                }
+            }
+        }
+    }
+}
+
+// Fijar las columnas del resultado: los bins de 0 a tamanoVentana / 2 - 1
+// cuya frecuencia cae en el rango configurado, o los filtros del banco
+template <typename T>
+void fijarRangoFrecuencias(const Espectrograma::Configuracion& config, Espectrograma::Resultado<T>& resultado) {
+    if (config.banco != Espectrograma::TipoBanco::Ninguno) {
+        if (!config.bandas.empty()) {
+            throw std::invalid_argument("Las bandas se acumulan sobre bins, no sobre un banco de filtros");
+        }
+        double fMaxima = config.frecuenciaMaxima > 0.0 ? config.frecuenciaMaxima
+                                                       : resultado.frecuenciaMuestreo / 2.0;
+        resultado.banco = Espectrograma::crearBancoFiltros(config.banco, config.numFiltros,
+                                                           config.frecuenciaMinima, fMaxima,
+                                                           resultado.resolucionFrecuencia,
+                                                           config.tamanoVentana / 2);
+        resultado.primerBin = 0;
+        resultado.numFrecuencias = config.numFiltros;
+        return;
+    }
+    
+    int ultimoBin = config.tamanoVentana / 2 - 1;   // Solo frecuencias positivas
+    int primerBin = std::max(0, (int)std::ceil(config.frecuenciaMinima / resultado.resolucionFrecuencia));
+    if (config.frecuenciaMaxima > 0.0) {
+        ultimoBin = std::min(ultimoBin, (int)std::floor(config.frecuenciaMaxima / resultado.resolucionFrecuencia));
+    }
+    if (ultimoBin < primerBin) {
+        throw std::invalid_argument("El rango de frecuencias no contiene ningún bin");
+    }
+    resultado.primerBin = primerBin;
+    resultado.numFrecuencias = ultimoBin - primerBin + 1;
+}
+
+// Llenar las filas de 'cantidad' ventanas silenciosas a partir de
+// 'primeraFila' con la magnitud cero en la escala configurada, sin transformarlas
+template <typename T>
+void llenarSilencio(int primeraFila, int cantidad, Espectrograma::Resultado<T>& resultado) {
+    Calculo<T> cero = (Calculo<T>)Espectrograma::aEscala(0.0, resultado.escala);
+    if (resultado.conMagnitudes) {
+        // Cuantizado: el valor 0, con la base en el piso de la escala
+        T valor = std::is_integral<T>::value ? T(0) : (T)cero;
+        std::fill(resultado.datosFila(primeraFila), resultado.datosFila((size_t)primeraFila + cantidad), valor);
+        if (resultado.escalaPorVentana) {
+            std::fill(resultado.basesFila.begin() + primeraFila,
+                      resultado.basesFila.begin() + primeraFila + cantidad, (float)cero);
+        }
+    }
+    
+    const Espectrograma::PlanBandas& plan = resultado.planBandas;
+    for (int v = primeraFila; v < primeraFila + cantidad; v++) {
+        double* bandas = resultado.datosBandas(v);
+        for (size_t b = 0; b < plan.numBandas(); b++) {
+            bandas[b] = plan.fin[b] > plan.inicio[b] ? (double)cero : 0.0;
+        }
+    }
+}
+
+// Fijar la escala de un espectrograma cuantizado (T entero): potencia en dB
+// en pasos de rangoDB / máximo de T
+template <typename T>
+void fijarCuantizacion(const Espectrograma::Configuracion& config, Espectrograma::Resultado<T>& resultado) {
+    if (!std::is_integral<T>::value) {
+        return;
+    }
+    if (config.rangoDB <= 0.0) {
+        throw std::invalid_argument("El rango de la cuantización debe ser positivo");
+    }
+    resultado.escala = Espectrograma::Escala::PotenciaLog;
+    resultado.pasoDB = config.rangoDB / std::numeric_limits<T>::max();
+    resultado.baseDB = config.maximoDB - config.rangoDB;
+    resultado.escalaPorVentana = config.cuantizarPorVentana;
+}
+
+// Llamar a 'procesar' con la transformada adecuada al tamaño de ventana: la
+// FFT especializada en compilación para los tamaños habituales o un plan real
+template <typename T, typename Funcion>
+void conTransformada(int tamanoVentana, Funcion&& procesar) {
+    switch (tamanoVentana) {
+        case 256:  procesar(FFTFijo<T, 256>()); break;
+        case 512:  procesar(FFTFijo<T, 512>()); break;
+        case 1024: procesar(FFTFijo<T, 1024>()); break;
+        case 2048: procesar(FFTFijo<T, 2048>()); break;
+        case 4096: procesar(FFTFijo<T, 4096>()); break;
+        default:
+            procesar(FFT::obtenerPlanReal<T>(tamanoVentana));
+            break;
+    }
+}
+
+// Como conTransformada, pero con una transformada propia que se puede
+// conservar entre llamadas y usar desde cualquier hilo
+template <typename T, typename Funcion>
+void conTransformadaPropia(int tamanoVentana, Funcion&& recibir) {
+    switch (tamanoVentana) {
+        case 256:  recibir(std::make_shared<const FFTFijo<T, 256>>()); break;
+        case 512:  recibir(std::make_shared<const FFTFijo<T, 512>>()); break;
+        case 1024: recibir(std::make_shared<const FFTFijo<T, 1024>>()); break;
+        case 2048: recibir(std::make_shared<const FFTFijo<T, 2048>>()); break;
+        case 4096: recibir(std::make_shared<const FFTFijo<T, 4096>>()); break;
+        default:
+            recibir(std::make_shared<const PlanFFTReal<T>>(tamanoVentana));
+            break;
+    }
+}
+
+// Ventanas mínimas por hilo: por debajo, crear el hilo cuesta más que sus FFT
+template <typename T>
+constexpr int ventanasMinimasPorHilo = 8 * PlanFFT<Calculo<T>>::anchoLote;
+
+// Hilos que se usarán para 'numVentanas' ventanas
+template <typename T>
+int hilosParaVentanas(int hilos, int numVentanas) {
+    if (hilos <= 0) {
+        hilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+    return std::max(1, std::min(hilos, numVentanas / ventanasMinimasPorHilo<T>));
+}
+
+// procesarVentanas repartido entre config.hilos hilos: cada uno transforma un
+// tramo contiguo de lotes completos y escribe en sus propias filas. El hilo
+// que llama usa 'plan' para el primer tramo; los demás crean el suyo (las FFT
+// especializadas y los planes de FFT::obtenerPlanReal son propios de cada hilo)
+template <typename T, typename Transformada>
+void transformarVentanas(const float* muestras, int numVentanas, const Espectrograma::Configuracion& config,
+                         const std::vector<Calculo<T>>& ventana, const Transformada& plan,
+                         Espectrograma::Resultado<T>& resultado, int primeraFila, bool mostrarProgreso) {
+    int hilos = hilosParaVentanas<T>(config.hilos, numVentanas);
+    if (hilos == 1) {
+        procesarVentanas(muestras, numVentanas, config, ventana, plan, resultado, primeraFila, mostrarProgreso);
+        return;
+    }
+    
+    const int lote = PlanFFT<Calculo<T>>::anchoLote;
+    int lotesPorHilo = ((numVentanas + lote - 1) / lote + hilos - 1) / hilos;
+    std::vector<int> limites(hilos + 1);
+    for (int k = 0; k <= hilos; k++) {
+        limites[k] = std::min(numVentanas, k * lotesPorHilo * lote);
+    }
+    
+    auto procesarTramo = [&](int k, const auto& transformada) {
+        procesarVentanas(muestras + (size_t)limites[k] * config.solapamiento, limites[k + 1] - limites[k],
+                         config, ventana, transformada, resultado, primeraFila + limites[k],
+                         mostrarProgreso && k == 0);
+    };
+    
+    std::vector<std::exception_ptr> errores(hilos);
+    std::vector<std::thread> trabajadores;
+    for (int k = 1; k < hilos; k++) {
+        trabajadores.emplace_back([&, k] {
+            try {
+                conTransformada<Calculo<T>>(config.tamanoVentana,
+                                            [&](const auto& propia) { procesarTramo(k, propia); });
+            } catch (...) {
+                errores[k] = std::current_exception();
+            }
+        });
+    }
+    try {
+        procesarTramo(0, plan);
+    } catch (...) {
+        errores[0] = std::current_exception();
+    }
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+    for (const std::exception_ptr& error : errores) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+}
+
+template <typename T>
+Espectrograma::Resultado<T> Espectrograma::calcular(
     const DatosAudio& audio, 
     const Configuracion& config
 ) {
-    Resultado resultado;
+    Resultado<T> resultado;
     
     std::cout << "\n=== Generando Espectrograma ===" << std::endl;
     std::cout << "Tamaño de ventana: " << config.tamanoVentana << " muestras" << std::endl;
@@ -23,75 +343,347 @@ Espectrograma::Resultado Espectrograma::calcular(
     // Calcular número de ventanas posibles
     int muestrasDisponibles = audio.muestras.size() - config.inicioAudio - config.tamanoVentana;
     resultado.numVentanas = (muestrasDisponibles / config.solapamiento) + 1;
-    resultado.numFrecuencias = config.tamanoVentana / 2; // Solo frecuencias positivas
     resultado.frecuenciaMuestreo = audio.frecuenciaMuestreo;
     resultado.resolucionFrecuencia = (double)audio.frecuenciaMuestreo / config.tamanoVentana;
     resultado.resolucionTemporal = (double)config.solapamiento / audio.frecuenciaMuestreo;
+    resultado.escala = config.escala;
+    fijarRangoFrecuencias(config, resultado);
+    fijarCuantizacion(config, resultado);
     
     std::cout << "Número de ventanas a procesar: " << resultado.numVentanas << std::endl;
     std::cout << "Resolución de frecuencia: " << resultado.resolucionFrecuencia << " Hz/bin" << std::endl;
+    if (resultado.pasoDB > 0.0) {
+        std::cout << "Cuantización: " << 8 * sizeof(T) << " bits, " << resultado.pasoDB << " dB por paso ("
+                  << (resultado.escalaPorVentana ? "escala por ventana" : "escala global") << ")" << std::endl;
+    }
+    if (!resultado.banco.vacio()) {
+        std::cout << "Banco de filtros " << (config.banco == TipoBanco::Mel ? "mel" : "logarítmico") << ": "
+                  << resultado.numFrecuencias << " filtros, centros " << resultado.frecuencia(0) << "-"
+                  << resultado.frecuencia(resultado.numFrecuencias - 1) << " Hz" << std::endl;
+    } else if (resultado.numFrecuencias < config.tamanoVentana / 2) {
+        std::cout << "Rango de frecuencias: " << resultado.frecuencia(0) << "-"
+                  << resultado.frecuencia(resultado.numFrecuencias - 1) << " Hz ("
+                  << resultado.numFrecuencias << " de " << config.tamanoVentana / 2 << " bins)" << std::endl;
+    }
     std::cout << "Resolución temporal: " << resultado.resolucionTemporal << " segundos/ventana" << std::endl;
     
     // Generar ventana de Hamming si es necesario
-    std::vector<double> ventana;
+    std::vector<Calculo<T>> ventana;
     if (config.aplicarHamming) {
-        ventana = ventanaHamming(config.tamanoVentana);
+        std::vector<double> hamming = ventanaHamming(config.tamanoVentana);
+        ventana.assign(hamming.begin(), hamming.end());
         std::cout << "Ventana de Hamming aplicada" << std::endl;
     }
     
-    // Procesar cada ventana
-    std::cout << "\nProcesando ventanas..." << std::endl;
-    int porcentajeAnterior = -1;
+    // Ajustar número real de ventanas (la última debe caber completa)
+    while (resultado.numVentanas > 0 &&
+           config.inicioAudio + (resultado.numVentanas - 1) * config.solapamiento
+               + config.tamanoVentana > (int)audio.muestras.size()) {
+        resultado.numVentanas--;
+    }
     
-    for (int v = 0; v < resultado.numVentanas; v++) {
-        // Mostrar progreso
-        int porcentaje = (100 * v) / resultado.numVentanas;
-        if (porcentaje != porcentajeAnterior && porcentaje % 10 == 0) {
-            std::cout << "  Progreso: " << porcentaje << "%" << std::endl;
-            porcentajeAnterior = porcentaje;
+    // Puerta de energía: marcar las ventanas silenciosas y recortar las del
+    // principio y el final (la ventana 0 pasa a ser la primera sonora)
+    int inicio = config.inicioAudio;
+    if (config.puertaEnergia && resultado.numVentanas > 0) {
+        resultado.silencio = ventanasSilenciosas(audio.muestras.data() + inicio, resultado.numVentanas, config);
+        
+        int iniciales = 0;
+        int finales = 0;
+        if (config.recortarSilencio) {
+            auto primera = std::find(resultado.silencio.begin(), resultado.silencio.end(), false);
+            iniciales = (int)(primera - resultado.silencio.begin());
+            if (primera != resultado.silencio.end()) {
+                auto ultima = std::find(resultado.silencio.rbegin(), resultado.silencio.rend(), false);
+                finales = (int)(ultima - resultado.silencio.rbegin());
+            }
+            resultado.silencio.erase(resultado.silencio.end() - finales, resultado.silencio.end());
+            resultado.silencio.erase(resultado.silencio.begin(), resultado.silencio.begin() + iniciales);
+            resultado.numVentanas = (int)resultado.silencio.size();
+            inicio += iniciales * config.solapamiento;
         }
         
-        // Calcular posición de inicio de esta ventana
-        int inicio = config.inicioAudio + (v * config.solapamiento);
+        int silenciosas = (int)std::count(resultado.silencio.begin(), resultado.silencio.end(), true);
+        std::cout << "Puerta de energía (" << config.umbralEnergiaDB << " dBFS): "
+                  << iniciales << " ventanas iniciales y " << finales << " finales recortadas, "
+                  << silenciosas << " intermedias sin FFT" << std::endl;
+    }
+    resultado.primeraMuestra = inicio;
+    resultado.planBandas = planificarBandas(config.bandas, resultado.resolucionFrecuencia,
+                                            resultado.numFrecuencias, resultado.primerBin);
+    resultado.conMagnitudes = config.guardarMagnitudes;
+    resultado.redimensionar(resultado.numVentanas, resultado.numFrecuencias);
+    
+    // Un único plan de FFT real y unos únicos búferes para todas las ventanas.
+    // Para los tamaños habituales se usa la FFT especializada en compilación.
+    conTransformada<Calculo<T>>(config.tamanoVentana, [&](const auto& plan) {
+        if (resultado.silencio.empty()) {
+            transformarVentanas(audio.muestras.data() + inicio, resultado.numVentanas, config, ventana, plan,
+                                resultado, 0, true);
+            return;
+        }
         
-        // Verificar que no nos salgamos del rango
-        if (inicio + config.tamanoVentana > audio.muestras.size()) {
-            resultado.numVentanas = v; // Ajustar número real de ventanas
+        // Series alternas de ventanas sonoras (transformadas) y silenciosas
+        for (int v = 0; v < resultado.numVentanas;) {
+            int fin = v;
+            while (fin < resultado.numVentanas && resultado.silencio[fin] == resultado.silencio[v]) {
+                fin++;
+            }
+            if (resultado.silencio[v]) {
+                llenarSilencio(v, fin - v, resultado);
+            } else {
+                transformarVentanas(audio.muestras.data() + inicio + (size_t)v * config.solapamiento, fin - v,
+                                    config, ventana, plan, resultado, v, false);
+            }
+            v = fin;
+        }
+    });
+    
+    std::cout << "  Progreso: 100%" << std::endl;
+    std::cout << "\n✓ Espectrograma generado exitosamente" << std::endl;
+    std::cout << "  Dimensiones: " << resultado.numVentanas << " ventanas × "
+              << resultado.numFrecuencias << " frecuencias" << std::endl;
+    
+    return resultado;
+}
+
+template <typename T>
+int Espectrograma::calcularPorBloques(
+    FuenteAudio& fuente,
+    const Configuracion& config,
+    const std::function<void(const Resultado<T>& tramo, int primeraVentana)>& procesar
+) {
+    std::cout << "\n=== Generando Espectrograma por bloques ===" << std::endl;
+    std::cout << "Tamaño de ventana: " << config.tamanoVentana << " muestras" << std::endl;
+    std::cout << "Solapamiento: " << config.solapamiento << " muestras ("
+              << (100.0 * config.solapamiento / config.tamanoVentana) << "%)" << std::endl;
+    std::cout << "Bloques de lectura: " << fuente.tamanoBloque() << " muestras" << std::endl;
+    
+    // Con varios hilos se acumulan ventanas suficientes para repartirlas
+    // entre todos antes de transformar (un bloque suelto da para pocos hilos)
+    int hilos = hilosParaVentanas<T>(config.hilos, std::numeric_limits<int>::max());
+    int ventanasPorTramo = hilos > 1 ? hilos * ventanasMinimasPorHilo<T> : 1;
+    
+    EspectrogramaIncremental<T> incremental(fuente.frecuenciaMuestreo(), config, procesar, ventanasPorTramo);
+    std::vector<float> bloque;
+    while (fuente.siguienteBloque(bloque)) {
+        incremental.agregar(bloque.data(), bloque.size());
+    }
+    int totalVentanas = incremental.finalizar();
+    
+    if (config.puertaEnergia) {
+        std::cout << "Puerta de energía (" << config.umbralEnergiaDB << " dBFS): "
+                  << incremental.silenciosasOmitidas() << " ventanas intermedias sin FFT" << std::endl;
+    }
+    
+    std::cout << "\n✓ Espectrograma generado exitosamente" << std::endl;
+    std::cout << "  Dimensiones: " << totalVentanas << " ventanas × "
+              << incremental.formato().numFrecuencias << " frecuencias" << std::endl;
+    
+    return totalVentanas;
+}
+
+template <typename T>
+EspectrogramaIncremental<T>::EspectrogramaIncremental(
+    int frecuenciaMuestreo,
+    const Espectrograma::Configuracion& config,
+    Receptor receptor,
+    int ventanasPorTramo
+) : config_(config), receptor_(std::move(receptor)) {
+    if (config.tamanoVentana <= 0 || config.solapamiento <= 0) {
+        throw std::invalid_argument("El tamaño de ventana y el salto deben ser positivos");
+    }
+    
+    // Metadatos comunes a todos los tramos
+    tramo_.numVentanas = 0;
+    tramo_.frecuenciaMuestreo = frecuenciaMuestreo;
+    tramo_.resolucionFrecuencia = (double)frecuenciaMuestreo / config.tamanoVentana;
+    tramo_.resolucionTemporal = (double)config.solapamiento / frecuenciaMuestreo;
+    tramo_.escala = config.escala;
+    fijarRangoFrecuencias(config, tramo_);
+    fijarCuantizacion(config, tramo_);
+    tramo_.planBandas = Espectrograma::planificarBandas(config.bandas, tramo_.resolucionFrecuencia,
+                                                       tramo_.numFrecuencias, tramo_.primerBin);
+    tramo_.conMagnitudes = config.guardarMagnitudes;
+    
+    if (config.aplicarHamming) {
+        std::vector<double> hamming = Espectrograma::ventanaHamming(config.tamanoVentana);
+        ventana_.assign(hamming.begin(), hamming.end());
+    }
+    
+    // Plan propio del objeto: se conserva entre llamadas y no depende del hilo
+    conTransformadaPropia<Calculo<T>>(config.tamanoVentana, [&](auto plan) {
+        transformar_ = [this, plan](const float* muestras, int numVentanas) {
+            transformarVentanas(muestras, numVentanas, config_, ventana_, *plan, tramo_, 0, false);
+        };
+    });
+    
+    // Capacidad para un tramo completo y para transformar de una vez los
+    // bloques grandes (los de FuenteAudio caben enteros)
+    minimoPendiente_ = (size_t)config.tamanoVentana
+                     + (size_t)(std::max(1, ventanasPorTramo) - 1) * config.solapamiento;
+    size_t necesaria = std::max(minimoPendiente_, (size_t)config.tamanoVentana + FuenteAudio::tamanoBloquePredeterminado);
+    capacidad_ = 1;
+    while (capacidad_ < necesaria) {
+        capacidad_ *= 2;
+    }
+    anillo_.assign(2 * capacidad_, 0.0f);
+    
+    porSaltar_ = config.inicioAudio > 0 ? (size_t)config.inicioAudio : 0;
+    buscandoInicio_ = config.puertaEnergia && config.recortarSilencio;
+}
+
+template <typename T>
+int EspectrogramaIncremental<T>::agregar(const float* muestras, size_t cantidad) {
+    recibidas_ += cantidad;
+    
+    int entregadas = 0;
+    while (cantidad > 0) {
+        // Descartar las muestras anteriores a inicioAudio o, con un salto
+        // mayor que la ventana, las que quedan entre dos ventanas
+        size_t saltadas = std::min(porSaltar_, cantidad);
+        porSaltar_ -= saltadas;
+        muestras += saltadas;
+        cantidad -= saltadas;
+        if (cantidad == 0) {
             break;
         }
         
-        // Preparar datos para FFT
-        std::vector<NumeroComplejo> datosFFT(config.tamanoVentana);
-        
-        for (int i = 0; i < config.tamanoVentana; i++) {
-            double muestra = audio.muestras[inicio + i];
-            
-            // Aplicar ventana si está configurado
-            if (config.aplicarHamming) {
-                muestra *= ventana[i];
-            }
-            
-            datosFFT[i] = NumeroComplejo(muestra, 0.0);
+        // Copiar lo que quepa, duplicado en las dos mitades del anillo
+        size_t copiar = std::min(cantidad, capacidad_ - (fin_ - inicio_));
+        for (size_t hecho = 0; hecho < copiar;) {
+            size_t posicion = (fin_ + hecho) & (capacidad_ - 1);
+            size_t contiguas = std::min(copiar - hecho, capacidad_ - posicion);
+            std::copy(muestras + hecho, muestras + hecho + contiguas, anillo_.begin() + posicion);
+            std::copy(muestras + hecho, muestras + hecho + contiguas, anillo_.begin() + posicion + capacidad_);
+            hecho += contiguas;
         }
+        fin_ += copiar;
+        muestras += copiar;
+        cantidad -= copiar;
         
-        // Aplicar FFT
-        FFT::calcular(datosFFT);
+        if (fin_ - inicio_ >= minimoPendiente_) {
+            entregadas += procesarPendientes();
+        }
+    }
+    return entregadas;
+}
+
+template <typename T>
+int EspectrogramaIncremental<T>::finalizar() {
+    // Ventanas que quedaron esperando a completar un tramo
+    if (fin_ - inicio_ >= (size_t)config_.tamanoVentana) {
+        procesarPendientes();
+    }
+    
+    if (config_.puertaEnergia && config_.recortarSilencio) {
+        silenciosas_ -= totalVentanas_ - (ultimaSonora_ + 1);
+        totalVentanas_ = ultimaSonora_ + 1;
+    }
+    return totalVentanas_;
+}
+
+template <typename T>
+int EspectrogramaIncremental<T>::procesarPendientes() {
+    const float* pendientes = anillo_.data() + (inicio_ & (capacidad_ - 1));
+    int enBloque = (int)((fin_ - inicio_ - config_.tamanoVentana) / config_.solapamiento) + 1;
+    int entregadas = 0;
+    
+    if (!config_.puertaEnergia) {
+        tramo_.redimensionar(enBloque, tramo_.numFrecuencias);
+        transformar_(pendientes, enBloque);
+        receptor_(tramo_, totalVentanas_);
+        totalVentanas_ += enBloque;
+        entregadas = enBloque;
+    } else {
+        std::vector<bool> silencio = Espectrograma::ventanasSilenciosas(pendientes, enBloque, config_);
         
-        // Extraer magnitudes (solo la mitad positiva del espectro)
-        std::vector<double> magnitudes(resultado.numFrecuencias);
-        for (int i = 0; i < resultado.numFrecuencias; i++) {
-            magnitudes[i] = datosFFT[i].magnitud();
+        // Las ventanas anteriores a la primera sonora no se numeran
+        int descartadas = 0;
+        if (buscandoInicio_) {
+            while (descartadas < enBloque && silencio[descartadas]) {
+                descartadas++;
+            }
+            buscandoInicio_ = descartadas == enBloque;
         }
         
-        resultado.magnitudes.push_back(magnitudes);
+        // Entregar cada serie de ventanas sonoras con su índice global
+        for (int v = descartadas; v < enBloque;) {
+            int fin = v;
+            while (fin < enBloque && silencio[fin] == silencio[v]) {
+                fin++;
+            }
+            if (silencio[v]) {
+                silenciosas_ += fin - v;
+            } else {
+                tramo_.redimensionar(fin - v, tramo_.numFrecuencias);
+                transformar_(pendientes + (size_t)v * config_.solapamiento, fin - v);
+                receptor_(tramo_, totalVentanas_ + v - descartadas);
+                ultimaSonora_ = totalVentanas_ + fin - 1 - descartadas;
+                entregadas += fin - v;
+            }
+            v = fin;
+        }
+        totalVentanas_ += enBloque - descartadas;
     }
     
-    std::cout << "  Progreso: 100%" << std::endl;
-    std::cout << "\n✓ Espectrograma generado exitosamente" << std::endl;
-    std::cout << "  Dimensiones: " << resultado.magnitudes.size() << " ventanas × "
-              << resultado.numFrecuencias << " frecuencias" << std::endl;
+    // Conservar sólo el solapamiento con las ventanas siguientes. Si el salto
+    // supera la ventana, el avance rebasa lo recibido y el resto se salta al llegar
+    size_t avance = (size_t)enBloque * config_.solapamiento;
+    size_t dentro = std::min(avance, fin_ - inicio_);
+    inicio_ += dentro;
+    porSaltar_ += avance - dentro;
+    return entregadas;
+}
+
+std::vector<bool> Espectrograma::ventanasSilenciosas(
+    const float* muestras,
+    int numVentanas,
+    const Configuracion& config
+) {
+    std::vector<bool> silencio(numVentanas > 0 ? numVentanas : 0, false);
+    if (numVentanas <= 0) {
+        return silencio;
+    }
     
-    return resultado;
+    // Sumas acumuladas de cuadrados en doble precisión: la energía de cada
+    // ventana es una resta, aunque las ventanas se solapen
+    size_t longitud = (size_t)(numVentanas - 1) * config.solapamiento + config.tamanoVentana;
+    std::vector<double> acumulada(longitud + 1);
+    acumulada[0] = 0.0;
+    for (size_t i = 0; i < longitud; i++) {
+        acumulada[i + 1] = acumulada[i] + (double)muestras[i] * muestras[i];
+    }
+    
+    // RMS >= 10^(dB/20)  <=>  energía media >= 10^(dB/10)
+    double umbral = std::pow(10.0, config.umbralEnergiaDB / 10.0) * config.tamanoVentana;
+    for (int v = 0; v < numVentanas; v++) {
+        size_t inicio = (size_t)v * config.solapamiento;
+        silencio[v] = acumulada[inicio + config.tamanoVentana] - acumulada[inicio] < umbral;
+    }
+    return silencio;
+}
+
+double Espectrograma::aEscala(double magnitud, Escala escala) {
+    switch (escala) {
+        case Escala::Potencia:
+            return magnitud * magnitud;
+        case Escala::PotenciaLog:
+            return 10.0 * std::log10(std::max(magnitud * magnitud, pisoPotencia));
+        default:
+            return magnitud;
+    }
+}
+
+double Espectrograma::aMagnitud(double valor, Escala escala) {
+    switch (escala) {
+        case Escala::Potencia:
+            return std::sqrt(valor);
+        case Escala::PotenciaLog:
+            return std::pow(10.0, valor / 20.0);
+        default:
+            return valor;
+    }
 }
 
 std::vector<double> Espectrograma::ventanaHamming(int tamano) {
@@ -102,72 +694,208 @@ std::vector<double> Espectrograma::ventanaHamming(int tamano) {
     return ventana;
 }
 
-void Espectrograma::exportarCSV(const Resultado& resultado, const std::string& nombreArchivo) {
+template <typename T>
+void Espectrograma::exportarCSV(const Resultado<T>& resultado, const std::string& nombreArchivo) {
+    if (!resultado.conMagnitudes) {
+        throw std::invalid_argument("El espectrograma sólo guardó sus bandas (Configuracion::guardarMagnitudes)");
+    }
     std::cout << "\nExportando espectrograma a CSV..." << std::endl;
     
-    std::ofstream archivo(nombreArchivo);
-    
-    if (!archivo.is_open()) {
-        throw std::runtime_error("No se pudo crear el archivo: " + nombreArchivo);
-    }
+    EscritorArchivo archivo(nombreArchivo);
     
     // Escribir encabezado con frecuencias
-    archivo << "Ventana,Tiempo(s)";
+    archivo.texto("Ventana,Tiempo(s)");
     for (int f = 0; f < resultado.numFrecuencias; f++) {
-        double frecuencia = f * resultado.resolucionFrecuencia;
-        archivo << "," << std::fixed << std::setprecision(2) << frecuencia << "Hz";
+        double frecuencia = resultado.frecuencia(f);
+        archivo.caracter(',').fijo(frecuencia, 2).texto("Hz");
     }
-    archivo << std::endl;
+    archivo.caracter('\n');
     
     // Escribir datos
-    for (size_t v = 0; v < resultado.magnitudes.size(); v++) {
+    for (size_t v = 0; v < (size_t)resultado.numVentanas; v++) {
         double tiempo = v * resultado.resolucionTemporal;
-        archivo << v << "," << std::fixed << std::setprecision(4) << tiempo;
+        archivo.entero((long long)v).caracter(',').fijo(tiempo, 4);
         
+        Vista<T> magnitudes = resultado.fila(v);
         for (int f = 0; f < resultado.numFrecuencias; f++) {
-            archivo << "," << std::scientific << std::setprecision(6) 
-                    << resultado.magnitudes[v][f];
+            archivo.caracter(',').cientifico(magnitudes[f], 6);
         }
-        archivo << std::endl;
+        archivo.caracter('\n');
     }
     
-    archivo.close();
+    archivo.cerrar();
     std::cout << "✓ Espectrograma exportado a '" << nombreArchivo << "'" << std::endl;
 }
 
+template <typename T>
+void Espectrograma::exportarBinario(const Resultado<T>& resultado, const std::string& nombreArchivo,
+                                    FormatoBinario formato) {
+    if (!resultado.conMagnitudes) {
+        throw std::invalid_argument("El espectrograma sólo guardó sus bandas (Configuracion::guardarMagnitudes)");
+    }
+    EscritorArchivo archivo(nombreArchivo);
+    archivo.cabeceraMatriz(formato, EscritorArchivo::matrizEspectrograma, resultado.numVentanas,
+                           resultado.numFrecuencias, resultado.resolucionFrecuencia,
+                           resultado.resolucionTemporal);
+    
+    // Filas sin el relleno del paso, convertidas a float32
+    std::vector<float> fila(resultado.numFrecuencias);
+    for (size_t v = 0; v < (size_t)resultado.numVentanas; v++) {
+        Vista<T> magnitudes = resultado.fila(v);
+        std::copy(magnitudes.begin(), magnitudes.end(), fila.begin());
+        archivo.bytes(fila.data(), fila.size() * sizeof(float));
+    }
+    
+    archivo.cerrar();
+    std::cout << "✓ Espectrograma exportado a '" << nombreArchivo << "' ("
+              << resultado.numVentanas << " × " << resultado.numFrecuencias << " float32)" << std::endl;
+}
+
+Espectrograma::BancoFiltros Espectrograma::crearBancoFiltros(
+    TipoBanco tipo,
+    int numFiltros,
+    double fMin,
+    double fMax,
+    double resolucionFrecuencia,
+    int numBins
+) {
+    if (numFiltros < 1 || fMax <= fMin || fMin < 0.0) {
+        throw std::invalid_argument("Banco de filtros: se necesita al menos un filtro y 0 <= fMin < fMax");
+    }
+    
+    // Escala en la que los bordes quedan equiespaciados y su inversa
+    std::function<double(double)> escala, inversa;
+    if (tipo == TipoBanco::Mel) {
+        escala = [](double f) { return 2595.0 * std::log10(1.0 + f / 700.0); };
+        inversa = [](double m) { return 700.0 * (std::pow(10.0, m / 2595.0) - 1.0); };
+    } else {
+        fMin = std::max(fMin, resolucionFrecuencia);
+        if (fMax <= fMin) {
+            throw std::invalid_argument("Banco de filtros: el rango no cubre ningún bin");
+        }
+        escala = [](double f) { return std::log(f); };
+        inversa = [](double l) { return std::exp(l); };
+    }
+    
+    std::vector<double> bordes(numFiltros + 2);
+    double inicio = escala(fMin), paso = (escala(fMax) - inicio) / (numFiltros + 1);
+    for (int i = 0; i < numFiltros + 2; i++) {
+        bordes[i] = inversa(inicio + i * paso);
+    }
+    
+    BancoFiltros banco;
+    banco.binMinimo = numBins;
+    banco.desplazamiento.push_back(0);
+    for (int i = 0; i < numFiltros; i++) {
+        double centro = bordes[i + 1];
+        double izquierda = std::min(bordes[i], centro - resolucionFrecuencia);
+        double derecha = std::max(bordes[i + 2], centro + resolucionFrecuencia);
+        
+        // Bins estrictamente dentro del triángulo (peso > 0)
+        int primero = std::max(0, (int)std::floor(izquierda / resolucionFrecuencia) + 1);
+        int ultimo = std::min(numBins - 1, (int)std::ceil(derecha / resolucionFrecuencia) - 1);
+        
+        size_t comienzo = banco.pesos.size();
+        double suma = 0.0;
+        for (int k = primero; k <= ultimo; k++) {
+            double f = k * resolucionFrecuencia;
+            double peso = f <= centro ? (f - izquierda) / (centro - izquierda)
+                                      : (derecha - f) / (derecha - centro);
+            banco.pesos.push_back(peso);
+            suma += peso;
+        }
+        if (suma <= 0.0) {
+            throw std::invalid_argument("Banco de filtros: un filtro cae fuera de los bins de la FFT");
+        }
+        for (size_t j = comienzo; j < banco.pesos.size(); j++) {
+            banco.pesos[j] /= suma;
+        }
+        
+        banco.primerBin.push_back(primero);
+        banco.desplazamiento.push_back(banco.pesos.size());
+        banco.centros.push_back(centro);
+        banco.binMinimo = std::min(banco.binMinimo, primero);
+        banco.binMaximo = std::max(banco.binMaximo, ultimo);
+    }
+    return banco;
+}
+
+template <typename T>
+void Espectrograma::aplicarBanco(const T* potencia, const BancoFiltros& banco, T* destino) {
+    for (size_t i = 0; i < banco.numFiltros(); i++) {
+        const T* bins = potencia + banco.primerBin[i];
+        double suma = 0.0;
+        for (size_t j = banco.desplazamiento[i]; j < banco.desplazamiento[i + 1]; j++) {
+            suma += banco.pesos[j] * bins[j - banco.desplazamiento[i]];
+        }
+        destino[i] = (T)suma;
+    }
+}
+
+Espectrograma::PlanBandas Espectrograma::planificarBandas(
+    const std::vector<std::pair<double, double>>& bandas,
+    double resolucionFrecuencia,
+    int numFrecuencias,
+    int primerBin
+) {
+    PlanBandas plan;
+    plan.definiciones = bandas;
+    for (const auto& banda : bandas) {
+        // Encontrar índices de frecuencia correspondientes (bins absolutos)
+        int indiceMin = std::max(primerBin, (int)(banda.first / resolucionFrecuencia));
+        int indiceMax = (int)(banda.second / resolucionFrecuencia);
+        
+        // Pasar a columnas del resultado
+        int inicio = indiceMin - primerBin;
+        int fin = std::min(indiceMax + 1 - primerBin, numFrecuencias);
+        plan.inicio.push_back(inicio);
+        plan.fin.push_back(std::max(inicio, fin));
+    }
+    return plan;
+}
+
+template <typename T>
+void Espectrograma::agregarBandas(const T* fila, const PlanBandas& plan, double* destino) {
+    for (size_t b = 0; b < plan.numBandas(); b++) {
+        // Calcular magnitud promedio en esta banda
+        double suma = 0.0;
+        for (int f = plan.inicio[b]; f < plan.fin[b]; f++) {
+            suma += fila[f];
+        }
+        int contador = plan.fin[b] - plan.inicio[b];
+        destino[b] = (contador > 0) ? (suma / contador) : 0.0;
+    }
+}
+
+template <typename T>
 std::vector<std::vector<double>> Espectrograma::dividirEnBandas(
-    const Resultado& resultado,
+    const Resultado<T>& resultado,
     const std::vector<std::pair<double, double>>& bandas
 ) {
     std::cout << "\nDividiendo espectrograma en bandas de frecuencia..." << std::endl;
     
-    std::vector<std::vector<double>> bandasResultado;
+    if (!resultado.banco.vacio()) {
+        throw std::invalid_argument("Las bandas se definen sobre bins, no sobre un banco de filtros");
+    }
     
-    for (size_t v = 0; v < resultado.magnitudes.size(); v++) {
-        std::vector<double> bandasVentana;
-        
-        for (const auto& banda : bandas) {
-            double minFrec = banda.first;
-            double maxFrec = banda.second;
-            
-            // Encontrar índices de frecuencia correspondientes
-            int indiceMin = (int)(minFrec / resultado.resolucionFrecuencia);
-            int indiceMax = (int)(maxFrec / resultado.resolucionFrecuencia);
-            
-            // Calcular magnitud promedio en esta banda
-            double suma = 0.0;
-            int contador = 0;
-            
-            for (int f = indiceMin; f <= indiceMax && f < resultado.numFrecuencias; f++) {
-                suma += resultado.magnitudes[v][f];
-                contador++;
-            }
-            
-            double promedio = (contador > 0) ? (suma / contador) : 0.0;
-            bandasVentana.push_back(promedio);
+    std::vector<std::vector<double>> bandasResultado(resultado.numVentanas);
+    
+    if (resultado.planBandas.definiciones == bandas) {
+        // Ya acumuladas durante la STFT
+        for (size_t v = 0; v < (size_t)resultado.numVentanas; v++) {
+            Vista<double> promedios = resultado.filaBandas(v);
+            bandasResultado[v].assign(promedios.begin(), promedios.end());
+        }
+    } else {
+        if (!resultado.conMagnitudes) {
+            throw std::invalid_argument("El espectrograma sólo guardó sus bandas y no coinciden con las pedidas");
+        }
+        PlanBandas plan = planificarBandas(bandas, resultado.resolucionFrecuencia, resultado.numFrecuencias,
+                                           resultado.primerBin);
+        for (size_t v = 0; v < (size_t)resultado.numVentanas; v++) {
+            bandasResultado[v].resize(bandas.size());
+            agregarBandas(resultado.fila(v).begin(), plan, bandasResultado[v].data());
         }
-        
-        bandasResultado.push_back(bandasVentana);
     }
     
     std::cout << "✓ Espectrograma dividido en " << bandas.size() << " bandas" << std::endl;
@@ -181,28 +909,84 @@ void Espectrograma::exportarBandasCSV(
 ) {
     std::cout << "\nExportando bandas de frecuencia a CSV..." << std::endl;
     
-    std::ofstream archivo(nombreArchivo);
-    
-    if (!archivo.is_open()) {
-        throw std::runtime_error("No se pudo crear el archivo: " + nombreArchivo);
-    }
+    EscritorArchivo archivo(nombreArchivo);
     
     // Escribir encabezado
-    archivo << "Ventana";
+    archivo.texto("Ventana");
     for (const auto& banda : definicionesBandas) {
-        archivo << "," << banda.first << "-" << banda.second << "Hz";
+        archivo.caracter(',').general(banda.first).caracter('-').general(banda.second).texto("Hz");
     }
-    archivo << std::endl;
+    archivo.caracter('\n');
     
     // Escribir datos
     for (size_t v = 0; v < bandas.size(); v++) {
-        archivo << v;
+        archivo.entero((long long)v);
         for (size_t b = 0; b < bandas[v].size(); b++) {
-            archivo << "," << std::scientific << std::setprecision(6) << bandas[v][b];
+            archivo.caracter(',').cientifico(bandas[v][b], 6);
         }
-        archivo << std::endl;
+        archivo.caracter('\n');
     }
     
-    archivo.close();
+    archivo.cerrar();
     std::cout << "✓ Bandas exportadas a '" << nombreArchivo << "'" << std::endl;
-}
\ No newline at end of file
+}
+
+void Espectrograma::exportarBandasBinario(
+    const std::vector<std::vector<double>>& bandas,
+    double resolucionTemporal,
+    const std::string& nombreArchivo,
+    FormatoBinario formato
+) {
+    size_t numBandas = bandas.empty() ? 0 : bandas[0].size();
+    
+    EscritorArchivo archivo(nombreArchivo);
+    archivo.cabeceraMatriz(formato, EscritorArchivo::matrizBandas, bandas.size(), numBandas,
+                           0.0, resolucionTemporal);
+    for (const auto& ventana : bandas) {
+        for (size_t b = 0; b < numBandas; b++) {
+            archivo.binario<float>(b < ventana.size() ? (float)ventana[b] : 0.0f);
+        }
+    }
+    
+    archivo.cerrar();
+    std::cout << "✓ Bandas exportadas a '" << nombreArchivo << "' ("
+              << bandas.size() << " × " << numBandas << " float32)" << std::endl;
+}
+
+// Instancias usadas por el proyecto
+template Espectrograma::Resultado<float> Espectrograma::calcular<float>(
+    const DatosAudio&, const Configuracion&);
+template Espectrograma::Resultado<double> Espectrograma::calcular<double>(
+    const DatosAudio&, const Configuracion&);
+template Espectrograma::Resultado<uint8_t> Espectrograma::calcular<uint8_t>(
+    const DatosAudio&, const Configuracion&);
+template Espectrograma::Resultado<uint16_t> Espectrograma::calcular<uint16_t>(
+    const DatosAudio&, const Configuracion&);
+template int Espectrograma::calcularPorBloques<float>(
+    FuenteAudio&, const Configuracion&,
+    const std::function<void(const Resultado<float>&, int)>&);
+template int Espectrograma::calcularPorBloques<double>(
+    FuenteAudio&, const Configuracion&,
+    const std::function<void(const Resultado<double>&, int)>&);
+template int Espectrograma::calcularPorBloques<uint8_t>(
+    FuenteAudio&, const Configuracion&,
+    const std::function<void(const Resultado<uint8_t>&, int)>&);
+template int Espectrograma::calcularPorBloques<uint16_t>(
+    FuenteAudio&, const Configuracion&,
+    const std::function<void(const Resultado<uint16_t>&, int)>&);
+template class EspectrogramaIncremental<float>;
+template class EspectrogramaIncremental<double>;
+template class EspectrogramaIncremental<uint8_t>;
+template class EspectrogramaIncremental<uint16_t>;
+template std::vector<std::vector<double>> Espectrograma::dividirEnBandas<float>(
+    const Resultado<float>&, const std::vector<std::pair<double, double>>&);
+template std::vector<std::vector<double>> Espectrograma::dividirEnBandas<double>(
+    const Resultado<double>&, const std::vector<std::pair<double, double>>&);
+template void Espectrograma::aplicarBanco<float>(const float*, const BancoFiltros&, float*);
+template void Espectrograma::aplicarBanco<double>(const double*, const BancoFiltros&, double*);
+template void Espectrograma::agregarBandas<float>(const float*, const PlanBandas&, double*);
+template void Espectrograma::agregarBandas<double>(const double*, const PlanBandas&, double*);
+template void Espectrograma::exportarCSV<float>(const Resultado<float>&, const std::string&);
+template void Espectrograma::exportarCSV<double>(const Resultado<double>&, const std::string&);
+template void Espectrograma::exportarBinario<float>(const Resultado<float>&, const std::string&, FormatoBinario);
+template void Espectrograma::exportarBinario<double>(const Resultado<double>&, const std::string&, FormatoBinario);
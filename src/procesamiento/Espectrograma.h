@@ -1,45 +1,269 @@
 #ifndef ESPECTROGRAMA_H
 #define ESPECTROGRAMA_H
 
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <functional>
+#include <utility>
 #include "../audio/LectorAudio.h"
+#include "../audio/FuenteAudio.h"
+#include "../utilidades/EscritorArchivo.h"
 #include "../utilidades/NumeroComplejo.h"
+#include "../utilidades/Vista.h"
+
+// Precisión en la que se calculan la FFT y las magnitudes de un espectrograma
+// de valores T: los cuantizados (enteros sin signo) se calculan en float y
+// sólo se guardan en 8 o 16 bits
+template <typename T> struct PrecisionCalculo { using Tipo = T; };
+template <> struct PrecisionCalculo<uint8_t> { using Tipo = float; };
+template <> struct PrecisionCalculo<uint16_t> { using Tipo = float; };
 
 class Espectrograma {
 public:
+    // Escala de los valores del espectrograma. Potencia y PotenciaLog evitan la
+    // raíz cuadrada por bin y conservan el orden de las magnitudes, así que
+    // DetectorPicos obtiene los mismos máximos y percentiles.
+    enum class Escala {
+        Magnitud,       // |X|
+        Potencia,       // |X|²
+        PotenciaLog     // 10·log10(|X|²) en dB
+    };
+    
+    // Banco de filtros triangulares aplicado a la potencia de cada ventana:
+    // centros equiespaciados en la escala mel o en log(f) (ver crearBancoFiltros)
+    enum class TipoBanco {
+        Ninguno,        // Bins de la FFT
+        Mel,            // mel = 2595 · log10(1 + f / 700)
+        Logaritmico     // Relación constante entre centros consecutivos (tipo constant-Q)
+    };
+    
     // Configuración del espectrograma
     struct Configuracion {
         int tamanoVentana = 1024;       // Tamaño de la ventana FFT
         int solapamiento = 512;          // 50% de solapamiento
         int inicioAudio = 0;             // Desde dónde empezar (para saltar silencio)
         bool aplicarHamming = true;      // Aplicar ventana de Hamming
+        Escala escala = Escala::Magnitud; // Escala de los valores por bin
+        
+        // Rango de frecuencias (Hz) que se calcula y se guarda: sólo los bins
+        // con frecuencia en [frecuenciaMinima, frecuenciaMaxima] (0: hasta
+        // Nyquist). Las columnas empiezan en Resultado::primerBin y
+        // DetectorPicos sólo busca picos dentro del rango (un rango de menos
+        // de 2 · vecinosLocales + 1 bins no da picos)
+        double frecuenciaMinima = 0.0;
+        double frecuenciaMaxima = 0.0;
+        
+        // Con un banco de filtros cada columna es un filtro (numFiltros
+        // columnas en lugar de tamanoVentana / 2 bins) que cubre el rango de
+        // frecuencias anterior; el valor es la potencia media del filtro en
+        // 'escala'. No se combina con 'bandas'. DetectorPicos necesita al
+        // menos 2 · vecinosLocales + 1 columnas (7 con el radio por defecto)
+        // para encontrar máximos locales; con menos filtros no hay picos.
+        TipoBanco banco = TipoBanco::Ninguno;
+        int numFiltros = 64;
+        
+        // Espectrogramas cuantizados (Resultado<uint8_t> o <uint16_t>): la
+        // potencia en dB se guarda en pasos de rangoDB / máximo del tipo, y la
+        // escala configurada se ignora (siempre PotenciaLog). Con escala global
+        // cada valor cubre [maximoDB - rangoDB, maximoDB]; por ventana, los
+        // rangoDB por debajo del máximo de la fila.
+        bool cuantizarPorVentana = false;
+        double rangoDB = 96.0;
+        double maximoDB = 60.0;
+        
+        // Puerta de energía: las ventanas cuyo RMS (sobre las muestras sin
+        // ventana de Hamming) queda por debajo del umbral no se transforman, y
+        // DetectorPicos y GeneradorHashes nunca las ven
+        bool puertaEnergia = false;
+        double umbralEnergiaDB = -60.0;  // dBFS (0 dB: RMS de una señal a escala completa)
+        bool recortarSilencio = true;    // Con la puerta: la ventana 0 es la primera sonora y se omite el silencio final
+        
+        // Hilos de la STFT (0: uno por núcleo). Las ventanas se reparten en
+        // tramos contiguos y cada hilo usa su propio plan y sus propios búferes;
+        // el resultado no depende del número de hilos
+        int hilos = 0;
+        
+        // Bandas (Hz) cuyo promedio se acumula dentro de la STFT, con cada
+        // fila todavía en caché (mismo valor que dividirEnBandas). Sin
+        // guardarMagnitudes sólo se conservan las bandas: la matriz completa
+        // no llega a reservarse y fila() no está disponible.
+        std::vector<std::pair<double, double>> bandas;
+        bool guardarMagnitudes = true;
+    };
+    
+    // Rangos de bins de cada banda, calculados una sola vez para una
+    // resolución de frecuencia (ver planificarBandas)
+    struct PlanBandas {
+        std::vector<std::pair<double, double>> definiciones;   // Hz
+        std::vector<int> inicio;        // Primer bin de cada banda
+        std::vector<int> fin;           // Bin siguiente al último (inicio == fin: banda vacía)
+        
+        size_t numBandas() const { return inicio.size(); }
+        bool vacio() const { return inicio.empty(); }
+    };
+    
+    // Banco de filtros como matriz dispersa por filas: el filtro i pondera los
+    // bins primerBin[i], primerBin[i] + 1, ... con pesos[desplazamiento[i]]
+    // ... pesos[desplazamiento[i + 1] - 1], que suman 1
+    struct BancoFiltros {
+        std::vector<int> primerBin;
+        std::vector<size_t> desplazamiento;     // numFiltros + 1 elementos
+        std::vector<double> pesos;
+        std::vector<double> centros;            // Frecuencia central de cada filtro (Hz)
+        int binMinimo = 0;                      // Bins que necesita el banco
+        int binMaximo = -1;
+        
+        size_t numFiltros() const { return centros.size(); }
+        bool vacio() const { return centros.empty(); }
     };
     
-    // Estructura de resultado
+    // Estructura de resultado. T es el tipo de las magnitudes: float para el
+    // pipeline de fingerprints, double para el modo de análisis/demo, uint8_t
+    // o uint16_t para guardar la potencia en dB cuantizada (1/4 o 1/2 de la
+    // memoria de float).
+    //
+    // Las magnitudes se guardan en un único búfer contiguo por filas: la fila
+    // de la ventana v empieza en v · paso, y paso redondea numFrecuencias a un
+    // múltiplo de 64 bytes para que cada fila empiece en su propia línea de
+    // caché. Se reserva de una vez y se recorre con fila(v), sin copias.
+    template <typename T = double>
     struct Resultado {
-        std::vector<std::vector<double>> magnitudes;  // [ventana][frecuencia]
+        std::vector<T> magnitudes;      // [ventana · paso + frecuencia], en 'escala'
+        size_t paso = 0;                // Elementos entre filas consecutivas
         int numVentanas;
-        int numFrecuencias;
+        int numFrecuencias;             // Columnas guardadas (bins del rango de frecuencias)
+        int primerBin = 0;              // Bin de la columna 0
+        BancoFiltros banco;             // Con banco de filtros, la columna f es el filtro f
         double resolucionFrecuencia;    // Hz por bin
         double resolucionTemporal;      // Segundos por ventana
         int frecuenciaMuestreo;
+        Escala escala = Escala::Magnitud;
+        int primeraMuestra = 0;         // Muestra donde empieza la ventana 0 (inicioAudio más el silencio recortado)
+        std::vector<bool> silencio;     // [ventana] descartada por la puerta de energía (fila a cero, sin FFT); vacío sin puerta
+        
+        // Bandas acumuladas durante la STFT (Configuracion::bandas)
+        PlanBandas planBandas;
+        std::vector<double> energiasBandas;     // [ventana · numBandas + banda]: promedio en 'escala'
+        bool conMagnitudes = true;              // false: sólo se guardaron las bandas
+        
+        // Cuantización (T entero): dB = base + valor · pasoDB, con una base
+        // común o una por ventana
+        double pasoDB = 0.0;                    // 0: sin cuantizar
+        double baseDB = 0.0;
+        bool escalaPorVentana = false;
+        std::vector<float> basesFila;           // [ventana] con escala por ventana
+        
+        // Magnitudes de la ventana v (numFrecuencias elementos)
+        Vista<T> fila(size_t v) const { return Vista<T>(magnitudes.data() + v * paso, numFrecuencias); }
+        T* datosFila(size_t v) { return magnitudes.data() + v * paso; }
+        
+        // Promedios de las bandas de la ventana v
+        Vista<double> filaBandas(size_t v) const {
+            return Vista<double>(energiasBandas.data() + v * planBandas.numBandas(), planBandas.numBandas());
+        }
+        double* datosBandas(size_t v) { return energiasBandas.data() + v * planBandas.numBandas(); }
+        
+        // Valor de la fila v (en 'escala' o cuantizado) de una magnitud lineal,
+        // y magnitud lineal de un valor de la fila v
+        double base(size_t v) const { return escalaPorVentana ? basesFila[v] : baseDB; }
+        double valorDe(size_t v, double magnitud) const {
+            double valor = Espectrograma::aEscala(magnitud, escala);
+            return pasoDB > 0.0 ? (valor - base(v)) / pasoDB : valor;
+        }
+        double magnitudDe(size_t v, double valor) const {
+            return Espectrograma::aMagnitud(pasoDB > 0.0 ? base(v) + valor * pasoDB : valor, escala);
+        }
+        
+        // Frecuencia (Hz) de la columna f
+        double frecuencia(int f) const {
+            return banco.vacio() ? (primerBin + f) * resolucionFrecuencia : banco.centros[f];
+        }
+        
+        // Fijar las dimensiones y reservar los búferes (conserva la capacidad
+        // ya reservada, así que un tramo reutilizado no vuelve a pedir memoria)
+        void redimensionar(int ventanas, int frecuencias) {
+            const size_t porLinea = 64 / sizeof(T) > 0 ? 64 / sizeof(T) : 1;
+            numVentanas = ventanas;
+            numFrecuencias = frecuencias;
+            paso = ((size_t)frecuencias + porLinea - 1) / porLinea * porLinea;
+            magnitudes.resize(conMagnitudes ? (size_t)ventanas * paso : 0);
+            energiasBandas.resize((size_t)ventanas * planBandas.numBandas());
+            basesFila.resize(escalaPorVentana ? ventanas : 0);
+        }
     };
     
-    // Calcular espectrograma completo
-    static Resultado calcular(const DatosAudio& audio, const Configuracion& config);
+    // Calcular espectrograma completo (FFT y magnitudes en precisión T)
+    template <typename T = double>
+    static Resultado<T> calcular(const DatosAudio& audio, const Configuracion& config);
+    
+    // Calcular el espectrograma leyendo la fuente bloque a bloque. 'procesar'
+    // recibe cada tramo de ventanas consecutivas (numVentanas filas) junto con
+    // el índice global de su primera ventana; el tramo se reutiliza después,
+    // así que la memoria no depende de la duración de la fuente. Devuelve el
+    // total de ventanas, idénticas a las que produciría calcular(). Con la
+    // puerta de energía las ventanas silenciosas no se entregan: los tramos
+    // son las series de ventanas sonoras, con su índice global.
+    template <typename T = double>
+    static int calcularPorBloques(
+        FuenteAudio& fuente,
+        const Configuracion& config,
+        const std::function<void(const Resultado<T>& tramo, int primeraVentana)>& procesar
+    );
+    
+    // Marcar las ventanas cuyo RMS queda por debajo de config.umbralEnergiaDB
+    // (sumas acumuladas de cuadrados: una pasada por la señal)
+    static std::vector<bool> ventanasSilenciosas(const float* muestras, int numVentanas, const Configuracion& config);
+    
+    // Convertir una magnitud lineal a la escala indicada y viceversa
+    static double aEscala(double magnitud, Escala escala);
+    static double aMagnitud(double valor, Escala escala);
     
     // Aplicar ventana de Hamming
     static std::vector<double> ventanaHamming(int tamano);
     
-    // Dividir en bandas de frecuencia (para Fase 3)
+    // Calcular los rangos de bins de cada banda: los bins [f / resolución,
+    // fMax / resolución] que existen entre las numFrecuencias columnas que
+    // empiezan en primerBin (el mismo criterio que dividirEnBandas)
+    static PlanBandas planificarBandas(const std::vector<std::pair<double, double>>& bandas,
+                                       double resolucionFrecuencia, int numFrecuencias, int primerBin = 0);
+    
+    // Crear un banco de numFiltros filtros triangulares entre fMin y fMax
+    // (Hz) sobre numBins bins: numFiltros + 2 frecuencias equiespaciadas en la
+    // escala del tipo (sin fMin, el logarítmico empieza en un bin) dan los
+    // bordes y el centro de cada filtro. Los filtros más estrechos que un bin
+    // se ensanchan a ±1 bin para que ninguno quede vacío.
+    static BancoFiltros crearBancoFiltros(TipoBanco tipo, int numFiltros, double fMin, double fMax,
+                                          double resolucionFrecuencia, int numBins);
+    
+    // Potencia media de cada filtro a partir de la potencia de los bins
+    // (sólo se leen los bins binMinimo ... binMaximo)
+    template <typename T>
+    static void aplicarBanco(const T* potencia, const BancoFiltros& banco, T* destino);
+    
+    // Promedio de cada banda de una fila de magnitudes, en 'destino'
+    template <typename T>
+    static void agregarBandas(const T* fila, const PlanBandas& plan, double* destino);
+    
+    // Dividir en bandas de frecuencia (para Fase 3). Si las bandas ya se
+    // acumularon durante la STFT sólo se copian; si no, se agregan las filas
+    // con un plan calculado una vez.
+    template <typename T>
     static std::vector<std::vector<double>> dividirEnBandas(
-        const Resultado& resultado,
+        const Resultado<T>& resultado,
         const std::vector<std::pair<double, double>>& bandas
     );
     
     // Exportar a CSV
-    static void exportarCSV(const Resultado& resultado, const std::string& nombreArchivo);
+    template <typename T>
+    static void exportarCSV(const Resultado<T>& resultado, const std::string& nombreArchivo);
+    
+    // Exportar la matriz ventanas × frecuencias en float32 (NPY o con la
+    // cabecera propia de EscritorArchivo), mucho más rápido y compacto que CSV.
+    // Con un rango de frecuencias la columna 0 es el bin primerBin.
+    template <typename T>
+    static void exportarBinario(const Resultado<T>& resultado, const std::string& nombreArchivo,
+                                FormatoBinario formato = FormatoBinario::NPY);
     
     // Exportar bandas a CSV
     static void exportarBandasCSV(
@@ -47,6 +271,71 @@ public:
         const std::vector<std::pair<double, double>>& definicionesBandas,
         const std::string& nombreArchivo
     );
+    
+    // Exportar la matriz ventanas × bandas en float32
+    static void exportarBandasBinario(
+        const std::vector<std::vector<double>>& bandas,
+        double resolucionTemporal,
+        const std::string& nombreArchivo,
+        FormatoBinario formato = FormatoBinario::NPY
+    );
+};
+
+// STFT incremental: recibe la señal en trozos de cualquier tamaño (p. ej. lo
+// que entrega una tarjeta de sonido) y entrega cada ventana en cuanto tiene
+// tamanoVentana muestras, con los mismos tramos, índices globales y puerta de
+// energía que calcularPorBloques (que se apoya en esta clase). Las muestras
+// pendientes se guardan en un búfer circular duplicado (cada muestra se
+// escribe en i y en i + capacidad), así que lo pendiente siempre es contiguo
+// en memoria y se transforma sin copiarlo; la memoria no crece con la duración.
+template <typename T = float>
+class EspectrogramaIncremental {
+public:
+    using Receptor = std::function<void(const Espectrograma::Resultado<T>& tramo, int primeraVentana)>;
+    
+    // ventanasPorTramo: ventanas que se acumulan antes de transformar. Con 1
+    // cada ventana se entrega en cuanto se completa (mínima latencia); con más,
+    // cada tramo se reparte entre config.hilos hilos.
+    EspectrogramaIncremental(int frecuenciaMuestreo, const Espectrograma::Configuracion& config,
+                             Receptor receptor, int ventanasPorTramo = 1);
+    
+    EspectrogramaIncremental(const EspectrogramaIncremental&) = delete;
+    EspectrogramaIncremental& operator=(const EspectrogramaIncremental&) = delete;
+    
+    // Agregar 'cantidad' muestras mono. Devuelve cuántas ventanas se entregaron.
+    int agregar(const float* muestras, size_t cantidad);
+    
+    // Terminar la señal: transformar las ventanas que esperaban a completar un
+    // tramo y recortar el silencio final. Devuelve el total de ventanas.
+    int finalizar();
+    
+    int totalVentanas() const { return totalVentanas_; }        // Numeradas hasta ahora
+    int silenciosasOmitidas() const { return silenciosas_; }    // Sin FFT por la puerta de energía
+    size_t muestrasRecibidas() const { return recibidas_; }
+    const Espectrograma::Resultado<T>& formato() const { return tramo_; }   // Metadatos de los tramos
+    
+private:
+    // Transformar todas las ventanas completas pendientes y entregarlas
+    int procesarPendientes();
+    
+    Espectrograma::Configuracion config_;
+    Receptor receptor_;
+    std::function<void(const float* muestras, int numVentanas)> transformar_;   // Con su propio plan
+    std::vector<typename PrecisionCalculo<T>::Tipo> ventana_;
+    Espectrograma::Resultado<T> tramo_;
+    
+    std::vector<float> anillo_;     // 2 × capacidad_ muestras
+    size_t capacidad_;              // Potencia de 2
+    size_t inicio_ = 0;             // Índice (tras inicioAudio) de la primera muestra pendiente
+    size_t fin_ = 0;                // Índice siguiente a la última recibida
+    size_t minimoPendiente_;        // Muestras que esperan antes de transformar
+    size_t porSaltar_;              // Muestras que se descartarán al llegar
+    size_t recibidas_ = 0;
+    
+    int totalVentanas_ = 0;
+    bool buscandoInicio_;           // Puerta de energía: aún no hubo ventana sonora
+    int ultimaSonora_ = -1;
+    int silenciosas_ = 0;
 };
 
 #endif
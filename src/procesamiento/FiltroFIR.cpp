@@ -0,0 +1,134 @@
+#include "FiltroFIR.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+std::vector<double> FiltroFIR::disenarPasaBanda(
+    double frecuenciaMinima,
+    double frecuenciaMaxima,
+    int frecuenciaMuestreo,
+    int numCoeficientes
+) {
+    if (numCoeficientes < 3 || numCoeficientes % 2 == 0) {
+        throw std::invalid_argument("El pasa banda necesita un número impar de coeficientes (mínimo 3)");
+    }
+    
+    double nyquist = frecuenciaMuestreo / 2.0;
+    if (frecuenciaMinima < 0.0 || frecuenciaMinima >= frecuenciaMaxima) {
+        throw std::invalid_argument("Rango de frecuencias del pasa banda inválido");
+    }
+    frecuenciaMaxima = std::min(frecuenciaMaxima, nyquist);
+    
+    // Frecuencias de corte normalizadas (ciclos por muestra)
+    double f1 = frecuenciaMinima / frecuenciaMuestreo;
+    double f2 = frecuenciaMaxima / frecuenciaMuestreo;
+    
+    int centro = numCoeficientes / 2;
+    std::vector<double> coeficientes(numCoeficientes);
+    for (int n = 0; n < numCoeficientes; n++) {
+        int m = n - centro;
+        
+        // Diferencia de dos pasa bajos ideales
+        double ideal;
+        if (m == 0) {
+            ideal = 2.0 * (f2 - f1);
+        } else {
+            ideal = (std::sin(2.0 * M_PI * f2 * m) - std::sin(2.0 * M_PI * f1 * m)) / (M_PI * m);
+        }
+        
+        double ventana = 0.42 - 0.5 * std::cos(2.0 * M_PI * n / (numCoeficientes - 1))
+                       + 0.08 * std::cos(4.0 * M_PI * n / (numCoeficientes - 1));
+        coeficientes[n] = ideal * ventana;
+    }
+    
+    // Normalizar a ganancia unitaria en el centro de la banda
+    double centroBanda = 0.5 * (f1 + f2);
+    double gananciaRe = 0.0, gananciaIm = 0.0;
+    for (int n = 0; n < numCoeficientes; n++) {
+        gananciaRe += coeficientes[n] * std::cos(2.0 * M_PI * centroBanda * n);
+        gananciaIm -= coeficientes[n] * std::sin(2.0 * M_PI * centroBanda * n);
+    }
+    double ganancia = std::sqrt(gananciaRe * gananciaRe + gananciaIm * gananciaIm);
+    if (ganancia > 0.0) {
+        for (double& c : coeficientes) {
+            c /= ganancia;
+        }
+    }
+    
+    return coeficientes;
+}
+
+std::vector<double> FiltroFIR::disenarPreenfasis(double coeficiente) {
+    return {1.0, -coeficiente};
+}
+
+std::vector<double> FiltroFIR::combinar(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.empty()) return b;
+    if (b.empty()) return a;
+    
+    std::vector<double> resultado(a.size() + b.size() - 1, 0.0);
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = 0; j < b.size(); j++) {
+            resultado[i + j] += a[i] * b[j];
+        }
+    }
+    return resultado;
+}
+
+std::vector<double> FiltroFIR::disenar(const Configuracion& config, int frecuenciaMuestreo) {
+    std::vector<double> coeficientes;
+    if (config.pasaBanda) {
+        coeficientes = disenarPasaBanda(config.frecuenciaMinima, config.frecuenciaMaxima,
+                                        frecuenciaMuestreo, config.numCoeficientes);
+    }
+    if (config.preenfasis) {
+        coeficientes = combinar(coeficientes, disenarPreenfasis(config.coeficientePreenfasis));
+    }
+    return coeficientes;
+}
+
+void FiltroFIR::aplicar(DatosAudio& audio, const Configuracion& config) {
+    std::vector<double> disenado = disenar(config, audio.frecuenciaMuestreo);
+    if (disenado.empty() || audio.muestras.empty()) {
+        return;
+    }
+    
+    std::vector<float> coeficientes(disenado.begin(), disenado.end());
+    ConvolucionFFT<float> convolucion(coeficientes, config.metodo);
+    
+    std::cout << "Aplicando prefiltro FIR (" << coeficientes.size() << " coeficientes, FFT de "
+              << convolucion.tamanoFFT() << ")" << std::endl;
+    
+    // Procesar (L - 1) / 2 ceros adicionales y descartar las primeras salidas
+    // para compensar el retardo de grupo del filtro
+    const size_t retardo = (coeficientes.size() - 1) / 2;
+    const size_t total = audio.muestras.size();
+    const int bloque = convolucion.tamanoBloque();
+    
+    std::vector<float> entrada(bloque);
+    std::vector<float> salida(bloque);
+    std::vector<float> filtrado(total);
+    
+    for (size_t inicio = 0; inicio < total + retardo; inicio += bloque) {
+        for (int i = 0; i < bloque; i++) {
+            size_t indice = inicio + i;
+            entrada[i] = indice < total ? audio.muestras[indice] : 0.0f;
+        }
+        
+        convolucion.procesarBloque(entrada.data(), salida.data());
+        
+        for (int i = 0; i < bloque; i++) {
+            size_t indice = inicio + i;
+            if (indice >= retardo && indice - retardo < total) {
+                filtrado[indice - retardo] = salida[i];
+            }
+        }
+    }
+    
+    audio.muestras.swap(filtrado);
+}
@@ -0,0 +1,42 @@
+#ifndef FILTRO_FIR_H
+#define FILTRO_FIR_H
+
+#include <vector>
+#include "../audio/LectorAudio.h"
+#include "../fft/ConvolucionFFT.h"
+
+// Prefiltros FIR aplicados al audio antes del espectrograma: pasa banda
+// (por defecto el rango 100-5000 Hz que usa DetectorPicos::filtrarPicos) y
+// preénfasis. Los filtros se combinan en un único FIR de fase lineal que se
+// aplica con ConvolucionFFT, compensando su retardo de grupo.
+class FiltroFIR {
+public:
+    struct Configuracion {
+        bool pasaBanda = true;
+        double frecuenciaMinima = 100.0;    // Hz
+        double frecuenciaMaxima = 5000.0;   // Hz
+        int numCoeficientes = 1023;         // Longitud del pasa banda (impar)
+        bool preenfasis = false;
+        double coeficientePreenfasis = 0.97;   // y[n] = x[n] - a·x[n-1]
+        ConvolucionFFT<float>::Metodo metodo = ConvolucionFFT<float>::Metodo::SolapamientoSuma;
+    };
+    
+    // Pasa banda por el método de ventana (sinc enventanado con Blackman)
+    static std::vector<double> disenarPasaBanda(double frecuenciaMinima, double frecuenciaMaxima,
+                                                int frecuenciaMuestreo, int numCoeficientes);
+    
+    // Preénfasis de primer orden: coeficientes {1, -a}
+    static std::vector<double> disenarPreenfasis(double coeficiente);
+    
+    // Convolución de dos filtros (equivale a aplicarlos en cascada)
+    static std::vector<double> combinar(const std::vector<double>& a, const std::vector<double>& b);
+    
+    // Coeficientes del filtro completo según la configuración
+    static std::vector<double> disenar(const Configuracion& config, int frecuenciaMuestreo);
+    
+    // Filtrar las muestras in-place. La salida se adelanta (L - 1) / 2 muestras
+    // para compensar el retardo del FIR, así que queda alineada con la entrada.
+    static void aplicar(DatosAudio& audio, const Configuracion& config);
+};
+
+#endif
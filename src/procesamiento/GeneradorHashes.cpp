@@ -1,8 +1,6 @@
 #include "GeneradorHashes.h"
 #include <iostream>
-#include <fstream>
 #include <algorithm>
-#include <iomanip>
 #include <cmath>
 #include <stdexcept>
 
@@ -98,15 +96,16 @@ uint32_t GeneradorHashes::codificarHash(
 }
 
 void GeneradorHashes::exportarHashes(const Resultado& resultado, const std::string& nombreArchivo, const std::string& nombreCancion) {
-    std::ofstream archivo(nombreArchivo);
-    if (!archivo.is_open()) return;
+    EscritorArchivo archivo(nombreArchivo);
     
-    archivo << "Hash_Hex,Timestamp,IndiceAncla,IndiceObjetivo\n";
+    archivo.texto("Hash_Hex,Timestamp,IndiceAncla,IndiceObjetivo\n");
     for (const auto& h : resultado.hashes) {
-        archivo << "0x" << std::hex << std::setw(8) << std::setfill('0') << h.valor << std::dec << ","
-                << std::fixed << std::setprecision(4) << h.tiempoAncla << ","
-                << h.indiceAncla << "," << h.indiceObjetivo << "\n";
+        archivo.texto("0x").hexadecimal(h.valor, 8).caracter(',')
+               .fijo(h.tiempoAncla, 4).caracter(',')
+               .entero(h.indiceAncla).caracter(',')
+               .entero(h.indiceObjetivo).caracter('\n');
     }
+    archivo.cerrar();
     std::cout << "[INFO] Exportado a " << nombreArchivo << std::endl;
 }
 
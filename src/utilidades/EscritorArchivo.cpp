@@ -0,0 +1,163 @@
+#include "EscritorArchivo.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+// Caracteres suficientes para cualquier double en notación fija con hasta
+// 'decimales' decimales (308 dígitos enteros, signo y punto)
+size_t maximoFijo(int decimales) {
+    return 320 + (size_t)std::max(0, decimales);
+}
+}
+
+EscritorArchivo::EscritorArchivo(const std::string& nombreArchivo, size_t capacidad)
+    : nombre_(nombreArchivo),
+      archivo_(std::fopen(nombreArchivo.c_str(), "wb")),
+      bufer_(std::max<size_t>(capacidad, 4096)) {
+    if (!archivo_) {
+        throw std::runtime_error("No se pudo crear el archivo: " + nombreArchivo);
+    }
+}
+
+EscritorArchivo::~EscritorArchivo() {
+    if (archivo_) {
+        vaciar();
+        std::fclose(archivo_);
+    }
+}
+
+char* EscritorArchivo::reservar(size_t cantidad) {
+    if (usados_ + cantidad > bufer_.size()) {
+        vaciar();
+        if (cantidad > bufer_.size()) {
+            bufer_.resize(cantidad);
+        }
+    }
+    return bufer_.data() + usados_;
+}
+
+void EscritorArchivo::vaciar() {
+    if (usados_ > 0 && std::fwrite(bufer_.data(), 1, usados_, archivo_) != usados_) {
+        error_ = true;
+    }
+    usados_ = 0;
+}
+
+EscritorArchivo& EscritorArchivo::texto(std::string_view cadena) {
+    return bytes(cadena.data(), cadena.size());
+}
+
+EscritorArchivo& EscritorArchivo::caracter(char c) {
+    *reservar(1) = c;
+    usados_++;
+    return *this;
+}
+
+EscritorArchivo& EscritorArchivo::entero(long long valor) {
+    char* destino = reservar(24);
+    usados_ = std::to_chars(destino, destino + 24, valor).ptr - bufer_.data();
+    return *this;
+}
+
+EscritorArchivo& EscritorArchivo::fijo(double valor, int decimales) {
+    size_t maximo = maximoFijo(decimales);
+    char* destino = reservar(maximo);
+    usados_ = std::to_chars(destino, destino + maximo, valor, std::chars_format::fixed, decimales).ptr
+            - bufer_.data();
+    return *this;
+}
+
+EscritorArchivo& EscritorArchivo::cientifico(double valor, int decimales) {
+    size_t maximo = 16 + (size_t)std::max(0, decimales);
+    char* destino = reservar(maximo);
+    usados_ = std::to_chars(destino, destino + maximo, valor, std::chars_format::scientific, decimales).ptr
+            - bufer_.data();
+    return *this;
+}
+
+EscritorArchivo& EscritorArchivo::general(double valor, int cifras) {
+    size_t maximo = 16 + (size_t)std::max(0, cifras);
+    char* destino = reservar(maximo);
+    usados_ = std::to_chars(destino, destino + maximo, valor, std::chars_format::general, cifras).ptr
+            - bufer_.data();
+    return *this;
+}
+
+EscritorArchivo& EscritorArchivo::hexadecimal(uint32_t valor, int ancho) {
+    char digitos[8];
+    char* fin = std::to_chars(digitos, digitos + sizeof(digitos), valor, 16).ptr;
+    int longitud = (int)(fin - digitos);
+
+    char* destino = reservar((size_t)std::max(ancho, longitud));
+    for (int i = longitud; i < ancho; i++) {
+        *destino++ = '0';
+    }
+    std::memcpy(destino, digitos, longitud);
+    usados_ = destino + longitud - bufer_.data();
+    return *this;
+}
+
+EscritorArchivo& EscritorArchivo::bytes(const void* datos, size_t cantidad) {
+    // Los bloques grandes van directos al archivo
+    if (cantidad >= bufer_.size()) {
+        vaciar();
+        if (std::fwrite(datos, 1, cantidad, archivo_) != cantidad) {
+            error_ = true;
+        }
+        return *this;
+    }
+    std::memcpy(reservar(cantidad), datos, cantidad);
+    usados_ += cantidad;
+    return *this;
+}
+
+EscritorArchivo& EscritorArchivo::cabeceraMatriz(
+    FormatoBinario formato,
+    uint16_t tipo,
+    size_t filas,
+    size_t columnas,
+    double resolucionFrecuencia,
+    double resolucionTemporal
+) {
+    if (formato == FormatoBinario::Crudo) {
+        texto("ADAB");
+        binario<uint16_t>(1);
+        binario<uint16_t>(tipo);
+        binario<uint32_t>((uint32_t)filas);
+        binario<uint32_t>((uint32_t)columnas);
+        binario<double>(resolucionFrecuencia);
+        binario<double>(resolucionTemporal);
+        return *this;
+    }
+
+    // NPY 1.0: magia, versión, longitud del diccionario (u16) y el diccionario
+    // rellenado con espacios hasta un múltiplo de 64 bytes, terminado en '\n'
+    std::string diccionario = "{'descr': '<f4', 'fortran_order': False, 'shape': ("
+                            + std::to_string(filas) + ", " + std::to_string(columnas) + "), }";
+    size_t total = 10 + diccionario.size() + 1;
+    diccionario.append((64 - total % 64) % 64, ' ');
+    diccionario.push_back('\n');
+
+    texto("\x93NUMPY");
+    caracter('\x01');
+    caracter('\x00');
+    binario<uint16_t>((uint16_t)diccionario.size());
+    texto(diccionario);
+    return *this;
+}
+
+void EscritorArchivo::cerrar() {
+    if (!archivo_) {
+        return;
+    }
+    vaciar();
+    if (std::fclose(archivo_) != 0) {
+        error_ = true;
+    }
+    archivo_ = nullptr;
+    if (error_) {
+        throw std::runtime_error("Error al escribir el archivo: " + nombre_);
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef ESCRITOR_ARCHIVO_H
+#define ESCRITOR_ARCHIVO_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Formatos binarios de exportación: matriz float32 por filas precedida por
+// una cabecera propia de 32 bytes (Crudo) o por la cabecera de NumPy (NPY,
+// se abre directamente con numpy.load)
+enum class FormatoBinario { Crudo, NPY };
+
+// Escritura de archivos con un búfer propio: los números se formatean con
+// std::to_chars directamente en el búfer (mismo texto que printf/iostream,
+// sin locale ni manipuladores) y el archivo sólo se toca cuando el búfer se
+// llena. Sirve para las exportaciones CSV y para las binarias.
+class EscritorArchivo {
+public:
+    // Crear el archivo. Lanza std::runtime_error si no se puede.
+    explicit EscritorArchivo(const std::string& nombreArchivo, size_t capacidad = 1 << 20);
+    ~EscritorArchivo();
+
+    EscritorArchivo(const EscritorArchivo&) = delete;
+    EscritorArchivo& operator=(const EscritorArchivo&) = delete;
+
+    // Texto
+    EscritorArchivo& texto(std::string_view cadena);
+    EscritorArchivo& caracter(char c);
+    EscritorArchivo& entero(long long valor);
+    EscritorArchivo& fijo(double valor, int decimales);          // Como std::fixed
+    EscritorArchivo& cientifico(double valor, int decimales);    // Como std::scientific
+    EscritorArchivo& general(double valor, int cifras = 6);      // Como el formato por defecto
+    EscritorArchivo& hexadecimal(uint32_t valor, int ancho);     // Relleno con ceros, sin prefijo
+
+    // Bytes crudos (los valores se escriben en el orden de bytes del sistema,
+    // little-endian en las plataformas soportadas)
+    EscritorArchivo& bytes(const void* datos, size_t cantidad);
+    template <typename U>
+    EscritorArchivo& binario(U valor) { return bytes(&valor, sizeof(U)); }
+
+    // Contenido de la matriz en la cabecera del formato Crudo
+    static constexpr uint16_t matrizEspectrograma = 1;
+    static constexpr uint16_t matrizBandas = 2;
+    static constexpr uint16_t matrizPicos = 3;
+
+    // Cabecera de una matriz float32 de filas × columnas en el formato
+    // indicado. Crudo: "ADAB", versión (u16), tipo (u16), filas y columnas
+    // (u32), resoluciones en Hz y en segundos (f64); 32 bytes en total.
+    EscritorArchivo& cabeceraMatriz(FormatoBinario formato, uint16_t tipo, size_t filas, size_t columnas,
+                                    double resolucionFrecuencia = 0.0, double resolucionTemporal = 0.0);
+
+    // Vaciar el búfer y cerrar. Lanza std::runtime_error si la escritura falló
+    // (el destructor cierra sin lanzar).
+    void cerrar();
+
+private:
+    // Asegurar 'cantidad' bytes libres en el búfer
+    char* reservar(size_t cantidad);
+    void vaciar();
+
+    std::string nombre_;
+    std::FILE* archivo_;
+    std::vector<char> bufer_;
+    size_t usados_ = 0;
+    bool error_ = false;
+};
+
+#endif
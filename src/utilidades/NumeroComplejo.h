@@ -3,26 +3,52 @@
 
 #include <cmath>
 
+// Número complejo parametrizado por el tipo escalar (float o double). Todo
+// está definido en la cabecera para que las operaciones se expandan en línea
+// dentro de los bucles de la FFT y del espectrograma.
+template <typename T>
 class NumeroComplejo {
 public:
-    double real;
-    double imaginario;
+    T real;
+    T imaginario;
     
-    NumeroComplejo(double r = 0.0, double i = 0.0);
+    constexpr NumeroComplejo(T r = T(0), T i = T(0)) : real(r), imaginario(i) {}
     
     // Operaciones básicas
-    NumeroComplejo operator+(const NumeroComplejo& otro) const;
-    NumeroComplejo operator-(const NumeroComplejo& otro) const;
-    NumeroComplejo operator*(const NumeroComplejo& otro) const;
+    constexpr NumeroComplejo operator+(const NumeroComplejo& otro) const {
+        return NumeroComplejo(real + otro.real, imaginario + otro.imaginario);
+    }
+    
+    constexpr NumeroComplejo operator-(const NumeroComplejo& otro) const {
+        return NumeroComplejo(real - otro.real, imaginario - otro.imaginario);
+    }
+    
+    constexpr NumeroComplejo operator*(const NumeroComplejo& otro) const {
+        return NumeroComplejo(
+            real * otro.real - imaginario * otro.imaginario,
+            real * otro.imaginario + imaginario * otro.real
+        );
+    }
+    
+    // Magnitud al cuadrado (potencia, sin raíz cuadrada)
+    constexpr T magnitudCuadrada() const {
+        return real * real + imaginario * imaginario;
+    }
     
     // Magnitud
-    double magnitud() const;
+    T magnitud() const {
+        return std::sqrt(magnitudCuadrada());
+    }
     
     // Fase
-    double fase() const;
+    T fase() const {
+        return std::atan2(imaginario, real);
+    }
     
     // Crear desde coordenadas polares
-    static NumeroComplejo desdePolares(double magnitud, double angulo);
+    static NumeroComplejo desdePolares(T magnitud, T angulo) {
+        return NumeroComplejo(magnitud * std::cos(angulo), magnitud * std::sin(angulo));
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,29 @@
+#ifndef VISTA_H
+#define VISTA_H
+
+#include <cstddef>
+
+// Vista de sólo lectura sobre un bloque contiguo de elementos que pertenece a
+// otro objeto (equivalente mínimo a std::span<const T> de C++20). No copia
+// ni libera nada: es válida mientras viva el dueño de la memoria.
+template <typename T>
+struct Vista {
+    const T* datos = nullptr;
+    size_t tamano = 0;
+
+    constexpr Vista() = default;
+    constexpr Vista(const T* d, size_t n) : datos(d), tamano(n) {}
+
+    constexpr const T* begin() const { return datos; }
+    constexpr const T* end() const { return datos + tamano; }
+    constexpr const T& operator[](size_t i) const { return datos[i]; }
+    constexpr size_t size() const { return tamano; }
+    constexpr bool empty() const { return tamano == 0; }
+
+    // Subvista de 'n' elementos a partir de 'inicio'
+    constexpr Vista subvista(size_t inicio, size_t n) const {
+        return Vista(datos + inicio, n);
+    }
+};
+
+#endif